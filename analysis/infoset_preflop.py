@@ -47,7 +47,8 @@ def plot_action_grid(actions_grid, num_actions, is_facing_bet, save_path = None)
         plt.savefig(save_path)
 
 if __name__ == "__main__":
-    # define checkpoint files to read
+    # define checkpoint files to read (training writes binary .ckpt files:
+    # 'convert_infoset v4_infosets_150post_ckpt<n>' also saves them as .txt)
     INFOSET_PATH = Path('../../data/cfr_data')
     INFOSET_FILENAME = 'v4_infosets_150post_ckpt1600000000.txt'
 
@@ -8,7 +8,8 @@ from infoset_functions import *
 N_CKPT = 100000000
 N_CKPT_NUM = 15
 
-# define checkpoint files to read
+# define checkpoint files to read (training writes binary .ckpt files:
+# 'convert_infoset v4_infosets_150post_ckpt<n>' also saves them as .txt)
 INFOSET_PATH = Path('../../data/cfr_data')
 ckpts = list(range(N_CKPT, (N_CKPT_NUM+1)*N_CKPT, N_CKPT))
 infoset_filenames = [
@@ -8,6 +8,7 @@
 
 #include "cfr.h"
 #include "binary.h"
+#include "mapped_infosets.h"
 #include "eval7pp.h"
 
 using namespace pokerbots::skeleton;
@@ -19,8 +20,9 @@ using namespace std::chrono;
 const int N_MC_ITER = 10000;
 const bool VERBOSE = false;
 
-// the bot will expect an unordered_map<ULL, CFRInfosetPure> infoset
-// if the following is set (else unordered_map<ULL, CFRInfoset>)
+// the bot will expect purified infosets mapped from data/infosets.map (see
+// mapped_infosets.h) if the following is set (else unordered_map<ULL,
+// CFRInfoset> from data/infosets.bin)
 #define PLAYER_USE_PURE
 
 // should the bot attempt to solve the river subgame?
@@ -40,7 +42,7 @@ struct Bot {
 
     DataContainer data;
     #ifdef PLAYER_USE_PURE
-    InfosetDictPure infosets;
+    MappedInfosets infosets;
     #else
     InfosetDict infosets;
     #endif
@@ -56,8 +58,14 @@ struct Bot {
     Bot() : data(), subgame(history, data, empty_pure_infosets) {
         _start = high_resolution_clock::now();
         // load equity data
-        // load flop buckets from binary
-        load_buckets_from_file_bin("data/flop_buckets.bin", &data.flop_buckets);
+        // load flop buckets from binary (see convert_equity_buckets). Every
+        // flop and turn lookup indexes the tables, so the bot can't play
+        // without them
+        if (!load_bucket_table_from_file("data/flop_bucket_table.bin", data.flop_buckets, FLOP_SIZE) ||
+                !load_bucket_table_from_file("data/turn_buckets.bin", data.turn_buckets, TURN_SIZE)) {
+            cout << "ERROR: missing bucket tables, see sync_lib.sh" << endl;
+            abort();
+        }
         load_clusters_from_file("data/turn_clusters.txt", data.turn_clusters);
         load_clusters_from_file("data/river_clusters.txt", data.river_clusters);
         cout << "Loaded equity data in " <<
@@ -65,8 +73,12 @@ struct Bot {
                     high_resolution_clock::now() - _start
                 ).count()) << " ms" << endl;
 
-        // load infosets
+        // load infosets (mapping them takes no time; pages are read on use)
+        #ifdef PLAYER_USE_PURE
+        infosets.open("data/infosets.map");
+        #else
         load_infosets_from_file_bin("data/infosets.bin", &infosets);
+        #endif
 
         cout << "Loaded " << infosets.size() << " in " << 
         duration_cast<std::chrono::milliseconds>(
@@ -283,12 +295,12 @@ struct Bot {
                                     history);
 
         #ifdef PLAYER_USE_PURE
-            if (infosets.find(key) == infosets.end()) {
+            if (!infosets.contains(key)) {
                 cout << "WARNING: No information for this state." << endl;
             }
         #endif
 
-        auto& infoset = fetch_infoset(infosets, key, available_actions.size());
+        auto infoset = fetch_infoset(infosets, key, available_actions.size());
 
         cout << "Infostate key: " << key << endl;
         if (VERBOSE) {
@@ -4,6 +4,7 @@
 // include after skeleton
 
 #include <string>
+#include <memory>
 
 #include "game.h"
 
@@ -154,23 +155,34 @@ int new_card_infostate(int street,
         array<int, TURN_SIZE> board_cards_array;
         copy_n(board_cards.begin(), TURN_SIZE, board_cards_array.begin());
 
+        // the precomputed table doesn't know about dead cards
+        if (!data.turn_buckets.empty() && common_dead == 0 && villain_dead == 0) {
+            return get_cards_info_state_turn(indices_to_mask(hand_cards),
+                                             indices_to_mask(board_cards_array), data);
+        }
+
         return get_bucket_from_clusters(
             indices_to_mask(hand_cards),
             indices_to_mask(board_cards_array),
             TURN_SIZE, data.turn_clusters, n_mc_iter,
-            common_dead, villain_dead);
+            common_dead, villain_dead, BUCKET_CONFIDENCE_Z);
     }
     else if (street == 5) {
 
         array<int, BOARD_SIZE> board_cards_array;
         copy_n(board_cards.begin(), BOARD_SIZE, board_cards_array.begin());
 
-        // do river evaluation exactly
+        // do river evaluation exactly. The board is fixed for the rest of
+        // the round, so its hands are evaluated once and reused
+        static unique_ptr<RiverBoardCache> river_cache;
+        ULL board_mask = indices_to_mask(board_cards_array);
+        if (!river_cache || river_cache->board != board_mask) {
+            river_cache.reset(new RiverBoardCache(get_river_board_cache(board_mask)));
+        }
+
         return get_bucket_from_clusters(
-            indices_to_mask(hand_cards),
-            indices_to_mask(board_cards_array),
-            BOARD_SIZE, data.river_clusters, 0,
-            common_dead, villain_dead);
+            indices_to_mask(hand_cards), *river_cache,
+            data.river_clusters, common_dead, villain_dead);
     }
 
     cout << "WARNING: invalid street to calculate card infostate on: " << street << endl;
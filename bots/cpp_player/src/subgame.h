@@ -9,6 +9,7 @@
 #include "player.h"
 #include "cfr.h"
 #include "gametree.h"
+#include "mapped_infosets.h"
 
 using namespace std;
 using namespace std::chrono;
@@ -36,7 +37,7 @@ struct Subgame {
     const vector<int> board_cards;
     const BoardActionHistory &history;
     const DataContainer &data;
-    InfosetDictPure &infosets;
+    const MappedInfosets &infosets;
 
     InfosetDict subgame_infosets;
 
@@ -62,7 +63,7 @@ struct Subgame {
     array<vector<array<int, HAND_SIZE>>, 2> full_range_list;
 
     Subgame(vector<int> init_board_cards, BoardActionHistory &init_history, 
-            DataContainer &init_data, InfosetDictPure &init_infosets) : 
+            DataContainer &init_data, const MappedInfosets &init_infosets) : 
             board_cards(init_board_cards), history(init_history),
             data(init_data), infosets(init_infosets) {
 
@@ -128,7 +129,7 @@ struct Subgame {
         bool in_range = true;
         for (int i = 0; i < range_conditions.size(); i++) {
             ULL full_key = info_to_key(range_conditions[i].first, card_key);
-            auto &infoset = fetch_infoset(infosets, full_key, 0);
+            CFRInfosetPure infoset = fetch_infoset(infosets, full_key, 0);
 
             if (infoset.action != range_conditions[i].second) {
                 in_range = false;
@@ -232,11 +233,12 @@ struct Subgame {
     }
 
     // run CFR iteration starting from river
-    pair<double, double> subgame_cfr(int winner, GameTreeNode &node,
+    pair<double, double> subgame_cfr(int winner, const FlatGameTree &tree,
+                            const FlatGameNode &node,
                             int card_key1, int card_key2) {
 
         // reached leaf node
-        if (node.children.size() == 0) {
+        if (node.num_children == 0) {
             assert(node.finished);
             // if no showdown, just return amount won according to history
             if (!node.showdown) {
@@ -262,33 +264,33 @@ struct Subgame {
         ULL key = info_to_key(node.history_key, card_info_state);
 
         // fetch infoset from subgame infoset dict
-        CFRInfoset& infoset = fetch_infoset(subgame_infosets, key, node.children.size());
+        CFRInfoset& infoset = fetch_infoset(subgame_infosets, key, node.num_children);
 
-        assert(infoset.cumu_regrets.size() == node.children.size());
+        assert(infoset.cumu_regrets.size() == node.num_children);
 
         ///////////////////////////////////////////////////            
         // we traverse both player's actions (asymmetric)
         
         // get strategy from infoset
-        vector<double> strategy = infoset.get_regret_matching_strategy();
-        assert(strategy.size() == node.children.size());
+        ActionValues strategy;
+        infoset.get_regret_matching_strategy(strategy.data());
         
         // iterate over possible actions
-        vector<double> utils(node.children.size());
+        ActionValues utils;
         pair<double, double> tot_val = {0, 0};
-        for (int i = 0; i < node.children.size(); i++) {
-            auto sub_val = subgame_cfr(winner, node.children[i], card_key1, card_key2);
+        for (int i = 0; i < node.num_children; i++) {
+            auto sub_val = subgame_cfr(winner, tree, tree.child(node, i), card_key1, card_key2);
 
             tot_val = tot_val + strategy[i]*sub_val;
             utils[i] = sub_val.first;
         }
 
         // utils -> regrets
-        for (int i = 0; i < utils.size(); i++) {
+        for (int i = 0; i < node.num_children; i++) {
             utils[i] -= tot_val.first;
         }
 
-        infoset.record(utils, strategy);
+        infoset.record(utils.data(), strategy.data());
         return tot_val;
 
     }
@@ -378,7 +380,10 @@ struct Subgame {
         assert(retrace.street == 3);
 
         // build a game tree using the initial river action as the root
-        GameTreeNode river_root = build_game_tree(retrace);
+        FlatGameTree river_tree(retrace);
+
+        // every showdown is on this board, so evaluate its hands once
+        RiverBoardCache river_cache = get_river_board_cache(board_mask);
 
         // CFR iterations
         pair<double, double> train_val = {0, 0};
@@ -398,12 +403,12 @@ struct Subgame {
                             high_resolution_clock::now() - cfr_deal_start).count());
 
             // determine winner given hands
-            int winner = evaluate(cfr_hand_masks[0] | board_mask, 7)
-                            < evaluate(cfr_hand_masks[1] | board_mask, 7);
+            int winner = river_cache.value(cfr_hand_masks[0])
+                            < river_cache.value(cfr_hand_masks[1]);
 
 
             auto val = subgame_cfr(
-                winner, river_root,
+                winner, river_tree, river_tree.root(),
                 get_cards_info_state_preflop(cfr_hand_indices[0]),
                 get_cards_info_state_preflop(cfr_hand_indices[1]));
 
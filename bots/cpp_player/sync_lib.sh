@@ -33,10 +33,13 @@ DATA_DIR="../../../data"
 if [ -d $DATA_DIR ]; then
     # change infosets here
     cp -R $DATA_DIR/cfr_data/infosets.bin.pure data/infosets.bin
+    cp -R $DATA_DIR/cfr_data/infosets.map data/infosets.map
 
-    cp -R $DATA_DIR/equity_data/flop_buckets_$NBUCKETS.bin data/flop_buckets.bin
+    # flat tables with a header (see convert_equity_buckets, compute_turn_buckets)
+    cp -R $DATA_DIR/equity_data/flop_bucket_table_$NBUCKETS.bin data/flop_bucket_table.bin
     cp -R $DATA_DIR/equity_data/turn_clusters_$NBUCKETS.txt data/turn_clusters.txt
     cp -R $DATA_DIR/equity_data/river_clusters_$NBUCKETS.txt data/river_clusters.txt
+    cp -R $DATA_DIR/equity_data/turn_buckets_$NBUCKETS.bin data/turn_buckets.bin
     
     cp -R $DATA_DIR/equity_data/flop_clusters_$NBUCKETS.txt data/flop_clusters.txt
 else
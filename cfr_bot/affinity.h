@@ -0,0 +1,98 @@
+#ifndef REAL_POKER_AFFINITY
+#define REAL_POKER_AFFINITY
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace std;
+
+// CPU placement of training threads (Linux only: elsewhere every CPU is
+// reported as allowed and on node 0, and pinning does nothing)
+
+// CPUs the process may run on, in increasing order
+inline vector<int> get_allowed_cpus() {
+    vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        cpus.push_back(0);
+    }
+    return cpus;
+}
+
+// CPU (or node) numbers in a sysfs list such as "0-3,8-11"
+inline vector<int> parse_cpu_list(const string &list) {
+    vector<int> cpus;
+    istringstream iss(list);
+    string range;
+    while (getline(iss, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        size_t dash = range.find('-');
+        int first = stoi(range.substr(0, dash));
+        int last = (dash == string::npos) ? first : stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+// NUMA node of each CPU up to max_cpu, from sysfs (all 0 if there is no
+// NUMA information). Node numbers can have gaps, so they are taken from the
+// list of online nodes rather than counted up
+inline vector<int> get_cpu_nodes(int max_cpu, const string &node_dir = "/sys/devices/system/node") {
+    vector<int> nodes(max_cpu + 1, 0);
+    ifstream online(node_dir + "/online");
+    string node_list;
+    if (!getline(online, node_list)) {
+        return nodes;
+    }
+    for (int node : parse_cpu_list(node_list)) {
+        ifstream file(node_dir + "/node" + to_string(node) + "/cpulist");
+        string list;
+        if (!getline(file, list)) {
+            continue;
+        }
+        for (int cpu : parse_cpu_list(list)) {
+            if (cpu <= max_cpu) {
+                nodes[cpu] = node;
+            }
+        }
+    }
+    return nodes;
+}
+
+// restrict the calling thread to cpus. Memory it touches first is then
+// placed on their NUMA node (Linux first-touch policy)
+inline bool pin_thread(const vector<int> &cpus) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+#endif
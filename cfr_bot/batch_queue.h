@@ -0,0 +1,115 @@
+#ifndef REAL_POKER_BATCH_QUEUE
+#define REAL_POKER_BATCH_QUEUE
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <iostream>
+
+#include "define.h"
+
+using namespace std;
+
+// how often threads had to wait on a BatchQueue, and for how long
+struct BatchQueueStats {
+    ULL batches = 0; // pushed
+    ULL items = 0; // in the pushed batches
+    ULL push_waits = 0; // pushes that found the queue full
+    ULL pop_waits = 0; // pops that found the queue empty
+    double push_wait_seconds = 0;
+    double pop_wait_seconds = 0;
+};
+
+inline ostream& operator<<(ostream& os, const BatchQueueStats& p) {
+    os << "BatchQueueStats(batches=" << p.batches << ",";
+    os << "items=" << p.items << ",";
+    os << "push_waits=" << p.push_waits << " (" << p.push_wait_seconds << "s),";
+    os << "pop_waits=" << p.pop_waits << " (" << p.pop_wait_seconds << "s))";
+    return os;
+}
+
+// bounded queue of batches between producer and consumer threads (any number
+// of each). Items move a batch at a time, so the lock is taken once per
+// batch, and a thread that finds the queue full (producer) or empty
+// (consumer) blocks on a condition variable instead of polling. Batches are
+// swapped in and out of the ring, so their buffers are reused and nothing is
+// allocated once running
+template<class T>
+struct BatchQueue {
+    vector<vector<T>> ring;
+    int head = 0; // next batch to pop
+    int count = 0; // batches in the ring
+    bool closed = false;
+    BatchQueueStats stats;
+
+    mutex queue_mutex;
+    condition_variable not_empty;
+    condition_variable not_full;
+
+    explicit BatchQueue(int capacity) : ring(capacity) {}
+
+    // hand batch over, waiting while the queue is full. batch is left
+    // holding an emptied buffer to fill next. Dropped once closed
+    void push(vector<T> &batch) {
+        unique_lock<mutex> lock(queue_mutex);
+        if (count == ring.size() && !closed) {
+            stats.push_waits++;
+            auto start = chrono::steady_clock::now();
+            not_full.wait(lock, [this] { return count < ring.size() || closed; });
+            stats.push_wait_seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        }
+        if (closed) {
+            batch.clear();
+            return;
+        }
+
+        stats.batches++;
+        stats.items += batch.size();
+        ring[(head + count) % ring.size()].swap(batch);
+        count++;
+        batch.clear();
+        lock.unlock();
+        not_empty.notify_one();
+    }
+
+    // next batch into batch (its old buffer goes back to the ring), waiting
+    // while the queue is empty. False once the queue is closed and empty
+    bool pop(vector<T> &batch) {
+        unique_lock<mutex> lock(queue_mutex);
+        if (count == 0 && !closed) {
+            stats.pop_waits++;
+            auto start = chrono::steady_clock::now();
+            not_empty.wait(lock, [this] { return count > 0 || closed; });
+            stats.pop_wait_seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        }
+        if (count == 0) {
+            return false;
+        }
+
+        ring[head].swap(batch);
+        head = (head + 1) % ring.size();
+        count--;
+        lock.unlock();
+        not_full.notify_one();
+        return true;
+    }
+
+    // wake every waiting thread: pushes are dropped from now on, and pops
+    // fail once the remaining batches are taken
+    void close() {
+        {
+            lock_guard<mutex> lock(queue_mutex);
+            closed = true;
+        }
+        not_full.notify_all();
+        not_empty.notify_all();
+    }
+
+    BatchQueueStats get_stats() {
+        lock_guard<mutex> lock(queue_mutex);
+        return stats;
+    }
+};
+
+#endif
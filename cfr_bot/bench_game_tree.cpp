@@ -0,0 +1,243 @@
+#include <chrono>
+#include "cfr.h"
+#include "gametree.h"
+#include "vector_cfr.h"
+
+using namespace std;
+using namespace std::chrono;
+
+// traversal speed of the recursive GameTreeNode tree against FlatGameTree,
+// and of fetching infosets from InfosetTable against DenseInfosetTable, then
+// vector CFR iterations (all buckets at once) on made-up board chance
+// usage: bench_game_tree [sampled traversals] [vector iterations]
+
+// every node of the tree, returning the number visited (won is summed so the
+// walk can't be optimized away)
+ULL sweep(const GameTreeNode &node, long long &sum) {
+    sum += node.won;
+    ULL count = 1;
+    for (int i = 0; i < node.children.size(); i++) {
+        count += sweep(node.children[i], sum);
+    }
+    return count;
+}
+
+ULL sweep(const FlatGameTree &tree, const FlatGameNode &node, long long &sum) {
+    sum += node.won;
+    ULL count = 1;
+    for (int i = 0; i < node.num_children; i++) {
+        count += sweep(tree, tree.child(node, i), sum);
+    }
+    return count;
+}
+
+// external-sampling shape without infosets: every action of seat 0, one
+// random action of seat 1
+double sampled_walk(const GameTreeNode &node, ULL &count) {
+    count++;
+    if (node.children.size() == 0) {
+        return node.won;
+    }
+    if (node.ind == 0) {
+        double value = 0;
+        for (int i = 0; i < node.children.size(); i++) {
+            value += sampled_walk(node.children[i], count);
+        }
+        return value / node.children.size();
+    }
+    return sampled_walk(node.children[random_below(node.children.size())], count);
+}
+
+double sampled_walk(const FlatGameTree &tree, const FlatGameNode &node, ULL &count) {
+    count++;
+    if (node.num_children == 0) {
+        return node.won;
+    }
+    if (node.ind == 0) {
+        double value = 0;
+        for (int i = 0; i < node.num_children; i++) {
+            value += sampled_walk(tree, tree.child(node, i), count);
+        }
+        return value / node.num_children;
+    }
+    return sampled_walk(tree, tree.child(node, random_below(node.num_children)), count);
+}
+
+// the same walk fetching each node's infoset and regret matching, as mccfr
+// does (with random card info)
+double sampled_cfr(const GameTreeNode &node, const array<int, NUM_STREETS> &card_info,
+                   InfosetTable &infosets, ULL &count) {
+    count++;
+    if (node.children.size() == 0) {
+        return node.won;
+    }
+    CFRInfosetRef infoset = infosets.fetch(info_to_key(node.history_key, card_info[node.street]),
+                                           node.children.size());
+    if (node.ind == 0) {
+        ActionValues strategy;
+        infoset.get_regret_matching_strategy(strategy.data());
+        double value = 0;
+        for (int i = 0; i < node.children.size(); i++) {
+            value += strategy[i] * sampled_cfr(node.children[i], card_info, infosets, count);
+        }
+        return value;
+    }
+    return sampled_cfr(node.children[infoset.get_action_index()], card_info, infosets, count);
+}
+
+double sampled_cfr(const FlatGameTree &tree, const FlatGameNode &node,
+                   const array<int, NUM_STREETS> &card_info, InfosetTable &infosets, ULL &count) {
+    count++;
+    if (node.num_children == 0) {
+        return node.won;
+    }
+    CFRInfosetRef infoset = infosets.fetch(info_to_key(node.history_key, card_info[node.street]),
+                                           node.num_children);
+    if (node.ind == 0) {
+        ActionValues strategy;
+        infoset.get_regret_matching_strategy(strategy.data());
+        double value = 0;
+        for (int i = 0; i < node.num_children; i++) {
+            value += strategy[i] * sampled_cfr(tree, tree.child(node, i), card_info, infosets, count);
+        }
+        return value;
+    }
+    return sampled_cfr(tree, tree.child(node, infoset.get_action_index()), card_info, infosets, count);
+}
+
+double sampled_cfr(const FlatGameTree &tree, const FlatGameNode &node,
+                   const array<int, NUM_STREETS> &card_info, DenseInfosetTable &infosets, ULL &count) {
+    count++;
+    if (node.num_children == 0) {
+        return node.won;
+    }
+    CFRInfosetRef infoset = infosets.at(node, card_info[node.street]);
+    if (node.ind == 0) {
+        ActionValues strategy;
+        infoset.get_regret_matching_strategy(strategy.data());
+        double value = 0;
+        for (int i = 0; i < node.num_children; i++) {
+            value += strategy[i] * sampled_cfr(tree, tree.child(node, i), card_info, infosets, count);
+        }
+        return value;
+    }
+    return sampled_cfr(tree, tree.child(node, infoset.get_action_index()), card_info, infosets, count);
+}
+
+void report(string name, ULL count, time_point<high_resolution_clock> start) {
+    double seconds = duration<double>(high_resolution_clock::now() - start).count();
+    cout << "  " << name << ": " << count / seconds / 1e6 << "M nodes/s" << endl;
+}
+
+int main(int argc, char *argv[]) {
+    int num_traversals = (argc > 1) ? atoi(argv[1]) : 200000;
+    int num_vector_iterations = (argc > 2) ? atoi(argv[2]) : 6;
+
+    array<GameTreeNode, 2> roots;
+    array<FlatGameTree, 2> trees;
+    long long sum = 0;
+    auto start = high_resolution_clock::now();
+    for (int btn = 0; btn < 2; btn++) {
+        roots[btn] = build_game_tree(BoardActionHistory(btn, 0, 0));
+    }
+    report("build recursive", sweep(roots[0], sum) + sweep(roots[1], sum), start);
+    start = high_resolution_clock::now();
+    for (int btn = 0; btn < 2; btn++) {
+        trees[btn] = FlatGameTree(BoardActionHistory(btn, 0, 0));
+    }
+    report("build flat", trees[0].nodes.size() + trees[1].nodes.size(), start);
+    cout << trees[0].nodes.size() << " nodes per tree, "
+        << sizeof(FlatGameNode) << " bytes per flat node" << endl;
+
+    ULL count = 0;
+    cout << "full sweeps:" << endl;
+    start = high_resolution_clock::now();
+    for (int n = 0; n < 20; n++) count += sweep(roots[n % 2], sum);
+    report("recursive", count, start);
+    count = 0;
+    start = high_resolution_clock::now();
+    for (int n = 0; n < 20; n++) count += sweep(trees[n % 2], trees[n % 2].root(), sum);
+    report("flat", count, start);
+
+    double value = 0;
+    cout << "sampled walks:" << endl;
+    gen.seed(1);
+    count = 0;
+    start = high_resolution_clock::now();
+    for (int n = 0; n < num_traversals; n++) value += sampled_walk(roots[n % 2], count);
+    report("recursive", count, start);
+    gen.seed(1);
+    count = 0;
+    start = high_resolution_clock::now();
+    for (int n = 0; n < num_traversals; n++) value += sampled_walk(trees[n % 2], trees[n % 2].root(), count);
+    report("flat", count, start);
+
+    // same card info in both runs, from few buckets so that the timed pass
+    // (after one to fill the table) mostly visits existing infosets
+    vector<array<int, NUM_STREETS>> card_infos(num_traversals);
+    for (auto &card_info : card_infos) {
+        card_info = {(int) random_below(169), (int) random_below(20),
+                     (int) random_below(20), (int) random_below(20)};
+    }
+    cout << "sampled traversals with infosets:" << endl;
+    for (int flat = 0; flat < 2; flat++) {
+        InfosetTable infosets;
+        gen.seed(2);
+        for (int pass = 0; pass < 2; pass++) {
+            count = 0;
+            start = high_resolution_clock::now();
+            for (int n = 0; n < num_traversals; n++) {
+                value += flat ? sampled_cfr(trees[n % 2], trees[n % 2].root(), card_infos[n], infosets, count)
+                              : sampled_cfr(roots[n % 2], card_infos[n], infosets, count);
+            }
+        }
+        report(flat ? "flat" : "recursive", count, start);
+    }
+    {
+        DenseInfosetTable infosets(trees[0], {169, 20, 20, 20});
+        gen.seed(2);
+        for (int pass = 0; pass < 2; pass++) {
+            count = 0;
+            start = high_resolution_clock::now();
+            for (int n = 0; n < num_traversals; n++) {
+                value += sampled_cfr(trees[n % 2], trees[n % 2].root(), card_infos[n], infosets, count);
+            }
+        }
+        report("flat dense", count, start);
+    }
+
+    // random transitions and showdowns with the 150 bucket sizes
+    array<int, NUM_STREETS> num_buckets = {169, 150, 150, 150};
+    BoardChance chance(num_buckets);
+    for (int street = 0; street < NUM_STREETS; street++) {
+        for (int b = 0; b < num_buckets[street]; b++) {
+            chance.prior[street][b] = 1. / num_buckets[street];
+        }
+    }
+    for (int street = 0; street < NUM_STREETS-1; street++) {
+        for (int b = 0; b < num_buckets[street]; b++) {
+            for (int next_b = 0; next_b < num_buckets[street+1]; next_b++) {
+                chance.transition(street, b, next_b) = 2*random_unit() / num_buckets[street+1];
+            }
+        }
+    }
+    for (int b = 0; b < num_buckets[NUM_STREETS-1]; b++) {
+        for (int opp_b = 0; opp_b < b; opp_b++) {
+            chance.showdown(opp_b, b) = 2*random_unit() - 1;
+            chance.showdown(b, opp_b) = -chance.showdown(opp_b, b);
+        }
+    }
+    DenseInfosetTable vector_infosets(trees[0], num_buckets);
+    count = 0;
+    start = high_resolution_clock::now();
+    for (int n = 0; n < num_vector_iterations; n++) {
+        value += vector_cfr_top(trees[n % 2], chance, vector_infosets);
+        count += trees[n % 2].nodes.size();
+    }
+    double seconds = duration<double>(high_resolution_clock::now() - start).count();
+    cout << "vector CFR: " << num_vector_iterations / seconds << " iterations/s, "
+        << count * 150 / seconds / 1e6 << "M node buckets/s" << endl;
+
+    cout << "(checksum " << sum + (long long) value << ")" << endl;
+    return 0;
+}
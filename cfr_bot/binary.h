@@ -2,6 +2,7 @@
 #define REAL_POKER_BINARY
 
 #include "cfr.h"
+#include "gametree.h"
 #include "compute_equity.h"
 
 #include <boost/archive/binary_iarchive.hpp>
@@ -84,6 +85,17 @@ inline void save_infosets_to_file_bin(string filename, unordered_map<ULL, T>& in
     archive << infoset_dict;
 }
 
+// training tables go through InfosetDict, so the format is unchanged
+inline void save_infosets_to_file_bin(string filename, InfosetTable& infosets) {
+    InfosetDict infoset_dict = infoset_table_to_dict(infosets);
+    save_infosets_to_file_bin(filename, infoset_dict);
+}
+
+inline void save_infosets_to_file_bin(string filename, DenseInfosetTable& infosets) {
+    InfosetDict infoset_dict = infoset_table_to_dict(infosets);
+    save_infosets_to_file_bin(filename, infoset_dict);
+}
+
 template<class T>
 inline void load_infosets_from_file_bin(string filename, unordered_map<ULL, T>* infoset_dict) {
     ifstream filestream(filename);
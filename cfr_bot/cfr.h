@@ -8,6 +8,12 @@
 #include <unordered_map>
 #include <random>
 #include <cassert>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
 
 #include "define.h"
 #include "game.h"
@@ -15,10 +21,6 @@
 
 using namespace std;
 
-extern random_device CFR_RD;
-extern mt19937 CFR_GEN;
-extern uniform_real_distribution<> CFR_RAND;
-
 const int SHIFT_PLAYER_IND = 1; // 1 bit for player position
 const int SHIFT_STREET = 2; // 2 bits for street
 const int SHIFT_CARD_INFO = 13; // 13 bits for card info
@@ -38,6 +40,31 @@ struct CFRInfosetPure : CFRInfosetBase {
     int get_action_index_avg();
 };
 
+// per-action values (strategy, utilities, regrets) at one node, on the stack
+// so a traversal doesn't allocate
+using ActionValues = array<double, MAX_ACTIONS>;
+
+// how record folds a visit into the stored regrets and strategy sums. Every
+// rule keeps them as averages (see record_average), and the discounts follow
+// the infoset's own visit count n, so they are applied lazily when the infoset
+// is visited instead of sweeping the whole table each iteration
+//  VANILLA: plain CFR, every visit weighted equally
+//  LINEAR: Linear CFR, visit n's regrets and strategy weighted by n
+//  CFR_PLUS: regrets floored at 0 after each visit, strategy weighted by n
+//  DISCOUNTED: DCFR, before visit n positive regrets are scaled by
+//      (n-1)^alpha/((n-1)^alpha+1) and negative ones by the same with beta,
+//      and visit n's strategy is weighted by n^gamma
+struct CFRUpdateRule {
+    enum Type { VANILLA, LINEAR, CFR_PLUS, DISCOUNTED };
+
+    Type type;
+    double alpha, beta, gamma;
+
+    CFRUpdateRule(Type init_type = VANILLA, double init_alpha = 1.5,
+                  double init_beta = 0, double init_gamma = 2)
+        : type(init_type), alpha(init_alpha), beta(init_beta), gamma(init_gamma) {}
+};
+
 // CFR infoset with full information (regrets, strategy) used in training
 struct CFRInfoset : CFRInfosetBase {
     ULL info = 0;
@@ -49,14 +76,104 @@ struct CFRInfoset : CFRInfosetBase {
     CFRInfoset(int num_actions);
     CFRInfoset(vector<double> init_cumu_regrets, vector<double> init_cumu_strategy, int init_t);
 
-    void record(vector<double> regrets, vector<double> strategy);
+    void record(const double regrets[], const double strategy[],
+                const CFRUpdateRule &rule = CFRUpdateRule());
+    void record(const vector<double> &regrets, const vector<double> &strategy,
+                const CFRUpdateRule &rule = CFRUpdateRule());
+    double cumulative_regret(int i, const CFRUpdateRule &rule = CFRUpdateRule()) const;
     int get_action_index_avg();
     vector<double> get_avg_strategy();
     int get_action_index(double eps = 0.0);
-    vector<double> get_regret_matching_strategy();
+    void get_regret_matching_strategy(double strategy[]) const;
+    vector<double> get_regret_matching_strategy() const;
+
+};
+
+// how an InfosetTable stores regrets and strategy sums. Both are running
+// averages (see record), so they stay within the largest utility and lose
+// little to a narrower type. The visit count shares the first value's bytes
+struct DoubleStorage {
+    using value_type = double;
+    using count_type = uint64_t;
+    static double load(double v) { return v; }
+    static double store(double x) { return x; }
+};
 
+struct FloatStorage {
+    using value_type = float;
+    using count_type = uint32_t;
+    static double load(float v) { return v; }
+    static float store(double x) { return (float) x; }
+};
+
+// fixed point: 2^22 steps per chip in an int32, so values within +-512
+// chips (utilities are at most the 400 chip pot) to about 2.4e-7
+struct FixedStorage {
+    using value_type = int32_t;
+    using count_type = uint32_t;
+    static constexpr double SCALE = 4194304.0;
+    static double load(int32_t v) { return v / SCALE; }
+    static int32_t store(double x) {
+        return (int32_t) llround(max(-2147483647.0, min(2147483647.0, x * SCALE)));
+    }
+};
+
+// storage used by InfosetTable (multi_mccfr): build with CFR_FLOAT_STORAGE or
+// CFR_FIXED_STORAGE to halve the slab
+#if defined(CFR_FLOAT_STORAGE)
+using RegretStorage = FloatStorage;
+#elif defined(CFR_FIXED_STORAGE)
+using RegretStorage = FixedStorage;
+#else
+using RegretStorage = DoubleStorage;
+#endif
+
+// view of one infoset stored in an InfosetTable, with the same training
+// interface as CFRInfoset. entry points into the table's slab: the visit
+// count t, then num_actions regrets, then num_actions strategy sums
+template<class Storage>
+struct CFRInfosetRefT {
+    using Value = typename Storage::value_type;
+    using Count = typename Storage::count_type;
+    static_assert(sizeof(Value) == sizeof(Count), "count must fit in one value");
+
+    Value *entry = nullptr;
+    int num_actions = 0;
+
+    CFRInfosetRefT() {}
+    CFRInfosetRefT(Value *init_entry, int init_num_actions)
+        : entry(init_entry), num_actions(init_num_actions) {}
+
+    int t() const {
+        Count t;
+        memcpy(&t, entry, sizeof(t));
+        return t;
+    }
+    void set_t(int t) {
+        Count count = t;
+        memcpy(entry, &count, sizeof(count));
+    }
+    Value* cumu_regrets() const { return entry + 1; }
+    Value* cumu_strategy() const { return entry + 1 + num_actions; }
+
+    // stored values converted back to doubles
+    double regret(int i) const { return Storage::load(entry[1 + i]); }
+    double strategy_sum(int i) const { return Storage::load(entry[1 + num_actions + i]); }
+
+    void record(const double regrets[], const double strategy[],
+                const CFRUpdateRule &rule = CFRUpdateRule());
+    void record(const vector<double> &regrets, const vector<double> &strategy,
+                const CFRUpdateRule &rule = CFRUpdateRule());
+    double cumulative_regret(int i, const CFRUpdateRule &rule = CFRUpdateRule()) const;
+    int get_action_index_avg();
+    vector<double> get_avg_strategy();
+    int get_action_index(double eps = 0.0);
+    void get_regret_matching_strategy(double strategy[]) const;
+    vector<double> get_regret_matching_strategy() const;
 };
 
+using CFRInfosetRef = CFRInfosetRefT<RegretStorage>;
+
 inline ostream& operator<<(ostream& os, CFRInfosetPure& p) {
     os << "CFRInfosetPure(action=" << p.action << ")";
     return os;
@@ -113,6 +230,120 @@ inline CFRInfosetPure& fetch_infoset(InfosetDictPure &infosets,
     return infosets[key];
 }
 
+// open-addressing (linear probing) infoset store for training. Keys sit in
+// one flat array, so a probe is a few adjacent loads instead of a node chase.
+// Each infoset's visit count, regrets and strategy sums are packed into one
+// slab entry; the slab is allocated in fixed-size blocks, so entries never
+// move and a CFRInfosetRef stays valid while the table grows.
+// fetch_concurrent() may be called from many threads at once: a new key is
+// claimed with a CAS and its entry published after it, and slab space comes
+// from an atomic bump pointer. Updates through the refs are not synchronized
+// (Hogwild: a racing record can lose an update). Growing is not concurrent,
+// so threads must stop fetching while grow() runs (see needs_grow())
+template<class Storage>
+struct InfosetTableT {
+    using Value = typename Storage::value_type;
+    using Ref = CFRInfosetRefT<Storage>;
+
+    static const ULL EMPTY_KEY = ~0ULL; // marks a free slot (never a real key)
+    static const int BLOCK_BITS = 20; // slab blocks of 2^20 values
+    static const int MAX_BLOCKS = 1 << 16;
+
+    vector<atomic<ULL>> keys; // power-of-two size
+    // slab offset of each slot's entry << 8 | number of actions, 0 until the
+    // thread that claimed the key has set up its entry
+    vector<atomic<ULL>> entries;
+    vector<atomic<Value*>> blocks; // MAX_BLOCKS, allocated on first use
+    atomic<ULL> slab_used; // doubles handed out (including block tails skipped)
+    atomic<ULL> num_infosets;
+    atomic<int> num_blocks;
+    mutex block_mutex;
+
+    explicit InfosetTableT(ULL capacity = 1024);
+    ~InfosetTableT();
+
+    ULL size() const { return num_infosets; }
+
+    // room for n infosets before the key array has to grow
+    void reserve(ULL n);
+
+    // true once the table is full enough that it should grow (load factor
+    // over 3/4); fetch_concurrent keeps working until it is 15/16 full
+    bool needs_grow() const {
+        return 4*num_infosets.load() > 3*keys.size();
+    }
+    void grow();
+
+    // the infoset for key, added with zero regrets/strategy if missing
+    // (grows the table when needed, so single-threaded use only)
+    Ref fetch(ULL key, int num_actions);
+    Ref fetch_concurrent(ULL key, int num_actions);
+
+    // false if the key isn't stored
+    bool find(ULL key, Ref &infoset) const;
+
+    // remove every infoset (keeps the key array's size)
+    void clear();
+
+    // add (or overwrite) an infoset, e.g. when loading from file
+    void insert(ULL key, int t, const vector<double> &cumu_regrets,
+                const vector<double> &cumu_strategy);
+    // same from several threads at once (no growing: reserve room first)
+    void insert_concurrent(ULL key, int t, const vector<double> &cumu_regrets,
+                           const vector<double> &cumu_strategy);
+
+    // slot-level access for iterating over all infosets
+    ULL num_slots() const { return keys.size(); }
+    bool occupied(ULL slot) const { return keys[slot].load(memory_order_relaxed) != EMPTY_KEY; }
+    ULL key(ULL slot) const { return keys[slot].load(memory_order_relaxed); }
+    Ref at(ULL slot) const {
+        ULL entry = entries[slot].load(memory_order_acquire);
+        while (entry == 0) { // claimed by another thread, entry not set up yet
+            entry = entries[slot].load(memory_order_acquire);
+        }
+        ULL offset = entry >> 8;
+        Value *block = blocks[offset >> BLOCK_BITS].load(memory_order_acquire);
+        return Ref(&block[offset & ((1ULL << BLOCK_BITS) - 1)], entry & 0xFF);
+    }
+
+    // bytes held by the key arrays and the slab
+    ULL memory_bytes() const;
+
+    // slot holding key, or the free slot where it would go
+    ULL probe(ULL key) const {
+        ULL mask = keys.size() - 1;
+        ULL slot = hash_key(key) & mask;
+        ULL slot_key = keys[slot].load(memory_order_acquire);
+        while (slot_key != key && slot_key != EMPTY_KEY) {
+            slot = (slot + 1) & mask;
+            slot_key = keys[slot].load(memory_order_acquire);
+        }
+        return slot;
+    }
+
+    // keys share most of their bits (history and card info are packed in
+    // fields), so mix them before masking (murmur3 finalizer)
+    static ULL hash_key(ULL key) {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33;
+        return key;
+    }
+
+private:
+    ULL allocate_entry(int num_actions);
+};
+
+using InfosetTable = InfosetTableT<RegretStorage>;
+
+template<class Storage>
+inline CFRInfosetRefT<Storage> fetch_infoset(InfosetTableT<Storage> &infosets,
+                                            ULL key, int num_actions) {
+    return infosets.fetch(key, num_actions);
+}
+
 inline ostream& operator<<(ostream& os, InfosetDict& p) {
     for (auto kv : p) {
         os << kv.first << " ";
@@ -126,46 +357,95 @@ inline ostream& operator<<(ostream& os, InfosetDict& p) {
     return os;
 }
 
-inline istream& operator>>(istream &in, InfosetDict& p)
-{
+// same text format as InfosetDict, so checkpoints load into either
+template<class Storage>
+inline ostream& operator<<(ostream& os, InfosetTableT<Storage>& p) {
+    for (ULL slot = 0; slot < p.num_slots(); slot++) {
+        if (!p.occupied(slot)) {
+            continue;
+        }
+        CFRInfosetRefT<Storage> infoset = p.at(slot);
+        os << p.key(slot) << " ";
+        os << infoset.t() << " ";
+        for (int i = 0; i < infoset.num_actions; i++) {
+            os << infoset.regret(i) << " ";
+            os << infoset.strategy_sum(i) << " ";
+        }
+        os << endl;
+    }
+    return os;
+}
+
+// one line of an infoset text file: key, t, then (regret, strategy) pairs
+inline bool read_infoset_line(istream &in, ULL &key, int &t,
+                              vector<double> &cumu_regrets,
+                              vector<double> &cumu_strategy) {
     string line;
-    ULL key;
-    int t;
     double e;
 
-    while (getline(in, line)) {
-        istringstream iss(line);
-        if (!(iss >> key)) {
-            break;
-        }
+    if (!getline(in, line)) {
+        return false;
+    }
 
-        iss >> t;
+    istringstream iss(line);
+    if (!(iss >> key)) {
+        return false;
+    }
 
-        vector<double> cumu_regrets;
-        vector<double> cumu_strategy;
-        while (iss >> e) {
-            cumu_regrets.push_back(e);
+    iss >> t;
 
-            iss >> e;
-            cumu_strategy.push_back(e);
-        }
+    cumu_regrets.clear();
+    cumu_strategy.clear();
+    while (iss >> e) {
+        cumu_regrets.push_back(e);
+
+        iss >> e;
+        cumu_strategy.push_back(e);
+    }
 
+    return true;
+}
+
+inline istream& operator>>(istream &in, InfosetDict& p)
+{
+    ULL key;
+    int t;
+    vector<double> cumu_regrets;
+    vector<double> cumu_strategy;
+
+    while (read_infoset_line(in, key, t, cumu_regrets, cumu_strategy)) {
         CFRInfoset infoset(cumu_regrets, cumu_strategy, t);
         p.insert(make_pair(key, infoset));
+    }
+
+    return in;
+}
 
+template<class Storage>
+inline istream& operator>>(istream &in, InfosetTableT<Storage>& p)
+{
+    ULL key;
+    int t;
+    vector<double> cumu_regrets;
+    vector<double> cumu_strategy;
+
+    while (read_infoset_line(in, key, t, cumu_regrets, cumu_strategy)) {
+        p.insert(key, t, cumu_regrets, cumu_strategy);
     }
 
     return in;
 }
 
-inline void save_infosets_to_file(string filename, InfosetDict &infosets) {
+template<class T>
+inline void save_infosets_to_file(string filename, T &infosets) {
     {
         ofstream outfile(filename);
         outfile << infosets;
     }
 }
 
-inline void load_infosets_from_file(string filename, InfosetDict &infosets) {
+template<class T>
+inline void load_infosets_from_file(string filename, T &infosets) {
 
     {
         ifstream infile(filename);
@@ -174,6 +454,92 @@ inline void load_infosets_from_file(string filename, InfosetDict &infosets) {
 
 }
 
+// folds other's visits into into as if both had been one run: the averages
+// are weighted by visit counts. Exact for VANILLA; the other rules weight
+// visits unequally, so merging only approximates them. Infosets loaded from
+// binary files have no regrets, which stay empty
+inline void merge_infoset(CFRInfoset &into, const CFRInfoset &other) {
+    assert(into.cumu_regrets.size() == other.cumu_regrets.size());
+    assert(into.cumu_strategy.size() == other.cumu_strategy.size());
+    int t = into.t + other.t;
+    if (t == 0) {
+        return;
+    }
+
+    double weight = (double) other.t / t;
+    for (int i = 0; i < into.cumu_regrets.size(); i++) {
+        into.cumu_regrets[i] += (other.cumu_regrets[i] - into.cumu_regrets[i]) * weight;
+    }
+    for (int i = 0; i < into.cumu_strategy.size(); i++) {
+        into.cumu_strategy[i] += (other.cumu_strategy[i] - into.cumu_strategy[i]) * weight;
+    }
+    into.t = t;
+}
+
+// merge_infoset for every infoset of other (added to into if missing)
+inline void merge_infosets(InfosetDict &into, const InfosetDict &other) {
+    for (auto &kv : other) {
+        auto it = into.find(kv.first);
+        if (it == into.end()) {
+            into.insert(kv);
+        }
+        else {
+            merge_infoset(it->second, kv.second);
+        }
+    }
+}
+
+// what training added to base to get trained: every infoset visited since,
+// with the new visits' count and averages over them alone, so merging the
+// deltas into base gives trained back
+inline InfosetDict get_infoset_deltas(const InfosetDict &trained, const InfosetDict &base) {
+    InfosetDict deltas;
+    for (auto &kv : trained) {
+        const CFRInfoset &infoset = kv.second;
+        auto it = base.find(kv.first);
+        int base_t = (it == base.end()) ? 0 : it->second.t;
+        if (infoset.t <= base_t) {
+            continue;
+        }
+
+        CFRInfoset delta = infoset;
+        delta.t = infoset.t - base_t;
+        if (base_t > 0) {
+            const CFRInfoset &base_infoset = it->second;
+            for (int i = 0; i < delta.cumu_regrets.size(); i++) {
+                delta.cumu_regrets[i] = (infoset.t * infoset.cumu_regrets[i]
+                    - base_t * base_infoset.cumu_regrets[i]) / delta.t;
+            }
+            for (int i = 0; i < delta.cumu_strategy.size(); i++) {
+                delta.cumu_strategy[i] = (infoset.t * infoset.cumu_strategy[i]
+                    - base_t * base_infoset.cumu_strategy[i]) / delta.t;
+            }
+        }
+        deltas.insert(make_pair(kv.first, delta));
+    }
+    return deltas;
+}
+
+// table contents as an InfosetDict (e.g. for the boost binary format)
+template<class Storage>
+inline InfosetDict infoset_table_to_dict(InfosetTableT<Storage> &infosets) {
+    InfosetDict dict;
+    dict.reserve(infosets.size());
+    for (ULL slot = 0; slot < infosets.num_slots(); slot++) {
+        if (!infosets.occupied(slot)) {
+            continue;
+        }
+        CFRInfosetRefT<Storage> infoset = infosets.at(slot);
+        vector<double> cumu_regrets(infoset.num_actions), cumu_strategy(infoset.num_actions);
+        for (int i = 0; i < infoset.num_actions; i++) {
+            cumu_regrets[i] = infoset.regret(i);
+            cumu_strategy[i] = infoset.strategy_sum(i);
+        }
+        dict[infosets.key(slot)] = CFRInfoset(cumu_regrets, cumu_strategy, infoset.t());
+    }
+    return dict;
+}
+
 template<size_t N>
 inline array<int, N> get_ranks_from_indices(array<int, N> a) {
     array<int, N> ranks;
@@ -188,10 +554,62 @@ inline bool compare_ranks_desc(int a, int b) {
     return a%NUM_RANKS > b%NUM_RANKS;
 }
 
-// compute equities and use cluster centers to give bucket
+// nearest cluster center to hand's equities against the fixed ranges
+int get_bucket_from_equities(const float equities[], const EquityClusters &clusters);
+
+// adaptive Monte Carlo bucketing: runouts sampled before the first check
+// (each check after that doubles them), the default z-score to stop at, and
+// how much worse (in squared distance) than the true nearest cluster a bucket
+// may be
+const int ADAPTIVE_MIN_SAMPLES = 32;
+const double BUCKET_CONFIDENCE_Z = 2.0;
+const double BUCKET_TOLERANCE = 1e-4;
+
+// work done by adaptive bucketing, next to what fixed-iteration bucketing
+// would have done for the same calls
+struct BucketStats {
+    long long calls = 0;
+    long long runouts = 0, max_runouts = 0;
+    long long evaluations = 0, max_evaluations = 0; // hero and villain hands
+    long long cluster_checks = 0, max_cluster_checks = 0; // distances to a cluster center
+};
+
+inline ostream& operator<<(ostream& os, const BucketStats& p) {
+    os << "BucketStats(calls=" << p.calls << ",";
+    os << "runouts=" << p.runouts << "/" << p.max_runouts << ",";
+    os << "evaluations=" << p.evaluations << "/" << p.max_evaluations << ",";
+    os << "cluster_checks=" << p.cluster_checks << "/" << p.max_cluster_checks << ")";
+    return os;
+}
+
+// compute equities and use cluster centers to give bucket (exactly if
+// iterations = 0). With confidence_z > 0, iterations is a cap: clusters are
+// pruned once they cannot be nearest within confidence_z standard errors,
+// ranges that no longer separate the remaining clusters stop being sampled,
+// and sampling stops once the nearest cluster is certain within tolerance
 int get_bucket_from_clusters(
     ULL hand, ULL board, int num_board, const EquityClusters &clusters,
-    int iterations, ULL common_dead = 0, ULL villain_dead = 0);
+    int iterations, ULL common_dead = 0, ULL villain_dead = 0,
+    double confidence_z = 0, double tolerance = BUCKET_TOLERANCE,
+    BucketStats *stats = nullptr);
+
+// river buckets for many hands on one board: evaluate the board once and
+// look up each hand's equities in the cache (same buckets as iterations = 0)
+RiverBoardCache get_river_board_cache(ULL board);
+int get_bucket_from_clusters(
+    ULL hand, const RiverBoardCache &cache, const EquityClusters &clusters,
+    ULL common_dead = 0, ULL villain_dead = 0);
+
+// exact bucket of every suit-isomorphic (hand, board) class with num_board
+// board cards (e.g. data.turn_buckets). Classes are split between num_threads
+// threads
+void compute_bucket_table(BucketTable &table, int num_board,
+                          const EquityClusters &clusters, int num_threads);
+
+// turn bucket from the precomputed table (no dead cards)
+inline int get_cards_info_state_turn(ULL hand, ULL board, const DataContainer &data) {
+    return data.turn_buckets[get_hand_indexer(TURN_SIZE).index(hand, board)];
+}
 
 inline int get_cards_info_state_preflop(array<int, HAND_SIZE> &c) {
     sort(c.begin(), c.end(), compare_ranks_desc);
@@ -208,35 +626,15 @@ inline int get_cards_info_state_preflop(array<int, HAND_SIZE> &c) {
 }
 
 inline int get_cards_info_state_flop(array<int, HAND_SIZE> c, array<int, FLOP_SIZE> flop, const DataContainer &data) {
-    sort(c.begin(), c.end(), compare_ranks_desc);
-    sort(flop.begin(), flop.begin() + FLOP_SIZE, compare_ranks_desc);
-
-    int suit_count = 0;
-    unordered_map<int, int> suit_iso;
-
-    int key = 0;
-    int mult = 1;
-
-    int card, suit;
-    for (int i = 0; i < FLOP_SIZE + HAND_SIZE; i++) {
-        card = (i < FLOP_SIZE) ? flop[i] : c[i-FLOP_SIZE];
-        suit = (card)/NUM_RANKS;
-        if (suit_iso.find(suit) == suit_iso.end()) {
-            suit_iso[suit] = suit_count;
-            suit_count++;
-        }
-        key += mult*(card%NUM_RANKS + NUM_RANKS*suit_iso[suit]);
-        mult *= NUM_RANKS*NUM_SUITS;
-    }
-
-    assert(data.flop_buckets.find(key) != data.flop_buckets.end());
-    return data.flop_buckets.at(key);
+    assert(!data.flop_buckets.empty()); // loaded (see DataContainer)
+    return data.flop_buckets[get_hand_indexer(FLOP_SIZE).index(indices_to_mask(c), indices_to_mask(flop))];
 }
 
 // get infostate for all streets, with different hole cards each street
 inline array<int, NUM_STREETS> get_cards_info_state(
     array<array<int, HAND_SIZE>, NUM_STREETS> c, array<int, BOARD_SIZE> board,
-    const DataContainer &data, int iterations = 1000) {
+    const DataContainer &data, int iterations = 1000,
+    BucketStats *stats = nullptr) {
     array<int, NUM_STREETS> info_states;
 
     //// pre-flop
@@ -253,8 +651,14 @@ inline array<int, NUM_STREETS> get_cards_info_state(
     copy(board.begin(), board.begin() + TURN_SIZE, turn_board.begin());
     ULL turn_mask = indices_to_mask(turn_board);
 
-    info_states[2] = get_bucket_from_clusters(
-        hand_mask_turn, turn_mask, TURN_SIZE, data.turn_clusters, iterations);
+    if (!data.turn_buckets.empty()) {
+        info_states[2] = get_cards_info_state_turn(hand_mask_turn, turn_mask, data);
+    }
+    else {
+        info_states[2] = get_bucket_from_clusters(
+            hand_mask_turn, turn_mask, TURN_SIZE, data.turn_clusters, iterations,
+            0, 0, BUCKET_CONFIDENCE_Z, BUCKET_TOLERANCE, stats);
+    }
 
     //// river
     ULL hand_mask_river = indices_to_mask(c[3]);
@@ -269,17 +673,26 @@ inline array<int, NUM_STREETS> get_cards_info_state(
 // get infostate for all streets
 inline array<int, NUM_STREETS> get_cards_info_state(
     array<int, HAND_SIZE> c, array<int, BOARD_SIZE> board,
-    const DataContainer &data, int iterations = 1000) {
+    const DataContainer &data, int iterations = 1000,
+    BucketStats *stats = nullptr) {
 
     array<array<int, HAND_SIZE>, NUM_STREETS> c_full;
     for (int i = 0; i < NUM_STREETS; i++) {
         c_full[i] = c;
     }
-    return get_cards_info_state(c_full, board, data, iterations);
+    return get_cards_info_state(c_full, board, data, iterations, stats);
+
+}
 
+// number of card infos get_cards_info_state can return on each street
+inline array<int, NUM_STREETS> get_num_card_infos(const DataContainer &data) {
+    int num_flop_buckets = data.flop_buckets.empty() ? 0
+        : *max_element(data.flop_buckets.begin(), data.flop_buckets.end()) + 1;
+    return {NUM_RANKS*NUM_RANKS, num_flop_buckets,
+            (int) data.turn_clusters.size(), (int) data.river_clusters.size()};
 }
 
-ULL info_to_key(int player_ind, int street, int card_info, BoardActionHistory &history);
+ULL info_to_key(int player_ind, int street, int card_info, const BoardActionHistory &history);
 
 const int SHIFT_CARD_INFO_TOTAL = SHIFT_PLAYER_IND + SHIFT_STREET;
 ULL info_to_key(ULL history_key, int card_info);
@@ -0,0 +1,313 @@
+#ifndef REAL_POKER_CHECKPOINT
+#define REAL_POKER_CHECKPOINT
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "cfr.h"
+#include "gametree.h"
+#include "fast_load.h"
+
+using namespace std;
+
+// binary checkpoints of training tables, written by several threads at once.
+// The table is split into shards (ranges of slots or card info blocks), each
+// thread sizes its shard, then encodes it straight to its place in the file
+// with a checksum, so nothing is formatted as text and the file isn't built
+// in memory. It is written under a temporary name and renamed when complete:
+//  header: CHECKPOINT_MAGIC, number of shards n (ULL), then per shard its
+//      size in bytes and FNV-1a checksum (ULLs)
+//  shards, back to back: records of key (ULL), t (uint32), number of actions
+//      (uint8), then (regret, strategy sum) doubles per action
+// Values are stored as doubles, so a checkpoint reloads exactly
+const char CHECKPOINT_MAGIC[8] = {'R', 'P', 'C', 'K', 'P', 'T', '0', '1'};
+
+// true for checkpoint paths (.ckpt), which the tools tell from text by name
+inline bool is_checkpoint_path(const string &path) {
+    return path.size() >= 5 && path.compare(path.size() - 5, 5, ".ckpt") == 0;
+}
+
+// checksum of bytes, continuing from hash
+inline ULL fnv1a_hash(const char *bytes, size_t n, ULL hash = 0xcbf29ce484222325ULL) {
+    for (size_t i = 0; i < n; i++) {
+        hash ^= (unsigned char) bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+inline size_t checkpoint_record_size(int num_actions) {
+    return sizeof(ULL) + sizeof(uint32_t) + sizeof(uint8_t) + 2 * num_actions * sizeof(double);
+}
+
+// units the shards are made of, and f(key, infoset) over the infosets saved
+// from units [begin, end): slots of an InfosetTable (every stored infoset, as
+// in its text format), card info blocks of a DenseInfosetTable (visited ones)
+template<class Storage>
+inline ULL num_checkpoint_units(InfosetTableT<Storage> &infosets) {
+    return infosets.num_slots();
+}
+
+template<class Storage, class F>
+inline void for_each_checkpoint_infoset(InfosetTableT<Storage> &infosets, ULL begin, ULL end, F f) {
+    for (ULL slot = begin; slot < end; slot++) {
+        if (infosets.occupied(slot)) {
+            f(infosets.key(slot), infosets.at(slot));
+        }
+    }
+}
+
+template<class Storage>
+inline ULL num_checkpoint_units(DenseInfosetTableT<Storage> &infosets) {
+    return infosets.num_blocks();
+}
+
+template<class Storage, class F>
+inline void for_each_checkpoint_infoset(DenseInfosetTableT<Storage> &infosets, ULL begin, ULL end, F f) {
+    infosets.for_each_visited(f, begin, end);
+}
+
+// writes infosets to filename using num_threads threads (one shard each).
+// The table must not change meanwhile (see multi_mccfr, which saves a
+// snapshot). False if the file couldn't be written
+template<class Table>
+inline bool save_infosets_to_file_ckpt(string filename, Table &infosets, int num_threads) {
+    using Ref = typename Table::Ref;
+    int num_shards = max(num_threads, 1);
+    ULL num_units = num_checkpoint_units(infosets);
+    vector<ULL> shard_begin(num_shards + 1);
+    for (int shard = 0; shard <= num_shards; shard++) {
+        shard_begin[shard] = num_units * shard / num_shards;
+    }
+    auto run_shards = [num_shards](const function<void(int)> &f) {
+        vector<thread> threads;
+        for (int shard = 1; shard < num_shards; shard++) {
+            threads.push_back(thread(f, shard));
+        }
+        f(0);
+        for (thread &t : threads) {
+            t.join();
+        }
+    };
+
+    // sizes, then each shard's place in the file
+    vector<ULL> shard_bytes(num_shards, 0), shard_checksums(num_shards, 0);
+    run_shards([&](int shard) {
+        ULL bytes = 0;
+        for_each_checkpoint_infoset(infosets, shard_begin[shard], shard_begin[shard + 1],
+                                    [&bytes](ULL key, Ref infoset) {
+            bytes += checkpoint_record_size(infoset.num_actions);
+        });
+        shard_bytes[shard] = bytes;
+    });
+    ULL header_bytes = sizeof(CHECKPOINT_MAGIC) + sizeof(ULL) * (1 + 2 * num_shards);
+    vector<ULL> shard_offset(num_shards, header_bytes);
+    for (int shard = 1; shard < num_shards; shard++) {
+        shard_offset[shard] = shard_offset[shard - 1] + shard_bytes[shard - 1];
+    }
+
+    string tmp_filename = filename + ".tmp";
+    int fd = open(tmp_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        cout << "WARNING: could not write checkpoint " << filename << endl;
+        return false;
+    }
+
+    // records go out in chunks of about 1 MB
+    const size_t CHUNK_BYTES = 1 << 20;
+    vector<char> shard_ok(num_shards, true); // not vector<bool>: set from several threads
+    run_shards([&](int shard) {
+        vector<char> chunk;
+        chunk.reserve(CHUNK_BYTES + checkpoint_record_size(MAX_ACTIONS));
+        ULL offset = shard_offset[shard];
+        ULL checksum = fnv1a_hash(nullptr, 0);
+        auto flush = [&]() {
+            checksum = fnv1a_hash(chunk.data(), chunk.size(), checksum);
+            if (pwrite(fd, chunk.data(), chunk.size(), offset) != (ssize_t) chunk.size()) {
+                shard_ok[shard] = false;
+            }
+            offset += chunk.size();
+            chunk.clear();
+        };
+
+        for_each_checkpoint_infoset(infosets, shard_begin[shard], shard_begin[shard + 1],
+                                    [&](ULL key, Ref infoset) {
+            size_t start = chunk.size();
+            uint32_t t = infoset.t();
+            uint8_t num_actions = infoset.num_actions;
+            chunk.resize(start + checkpoint_record_size(num_actions));
+            char *record = &chunk[start];
+            memcpy(record, &key, sizeof(key));
+            record += sizeof(key);
+            memcpy(record, &t, sizeof(t));
+            record += sizeof(t);
+            memcpy(record, &num_actions, sizeof(num_actions));
+            record += sizeof(num_actions);
+            for (int i = 0; i < num_actions; i++) {
+                double values[2] = {infoset.regret(i), infoset.strategy_sum(i)};
+                memcpy(record, values, sizeof(values));
+                record += sizeof(values);
+            }
+            if (chunk.size() >= CHUNK_BYTES) {
+                flush();
+            }
+        });
+        flush();
+        shard_checksums[shard] = checksum;
+    });
+
+    vector<char> header(header_bytes);
+    char *p = header.data();
+    ULL n = num_shards;
+    memcpy(p, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    p += sizeof(CHECKPOINT_MAGIC);
+    memcpy(p, &n, sizeof(n));
+    p += sizeof(n);
+    for (int shard = 0; shard < num_shards; shard++) {
+        memcpy(p, &shard_bytes[shard], sizeof(ULL));
+        p += sizeof(ULL);
+        memcpy(p, &shard_checksums[shard], sizeof(ULL));
+        p += sizeof(ULL);
+    }
+    bool ok = pwrite(fd, header.data(), header.size(), 0) == (ssize_t) header.size();
+    for (int shard = 0; shard < num_shards; shard++) {
+        ok = ok && shard_ok[shard];
+    }
+    ok = (fsync(fd) == 0) && ok;
+    ok = (close(fd) == 0) && ok;
+    if (!ok || rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+        cout << "WARNING: could not write checkpoint " << filename << endl;
+        remove(tmp_filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+// adds a loaded infoset to either table, or to an InfosetDict
+template<class Table>
+inline void insert_checkpoint_infoset(Table &infosets, ULL key, int t,
+                                      const vector<double> &cumu_regrets,
+                                      const vector<double> &cumu_strategy) {
+    infosets.insert(key, t, cumu_regrets, cumu_strategy);
+}
+
+inline void insert_checkpoint_infoset(InfosetDict &infosets, ULL key, int t,
+                                      const vector<double> &cumu_regrets,
+                                      const vector<double> &cumu_strategy) {
+    infosets[key] = CFRInfoset(cumu_regrets, cumu_strategy, t);
+}
+
+// header size of the checkpoint file (size bytes), or 0 with a warning if
+// it isn't a checkpoint or fails its checksums
+inline ULL check_checkpoint(const char *file, size_t size, const string &filename) {
+    ULL num_shards = 0;
+    if (size >= sizeof(CHECKPOINT_MAGIC) + sizeof(ULL)) {
+        memcpy(&num_shards, file + sizeof(CHECKPOINT_MAGIC), sizeof(ULL));
+    }
+    if (size < sizeof(CHECKPOINT_MAGIC) + sizeof(ULL)
+            || memcmp(file, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC)) != 0
+            || num_shards > size / (2 * sizeof(ULL))
+            || size < sizeof(CHECKPOINT_MAGIC) + sizeof(ULL) * (1 + 2 * num_shards)) {
+        cout << "WARNING: " << filename << " isn't a checkpoint" << endl;
+        return 0;
+    }
+    ULL header_bytes = sizeof(CHECKPOINT_MAGIC) + sizeof(ULL) * (1 + 2 * num_shards);
+
+    const char *header = file + sizeof(CHECKPOINT_MAGIC) + sizeof(ULL);
+    ULL offset = header_bytes;
+    for (ULL shard = 0; shard < num_shards; shard++) {
+        ULL bytes, checksum;
+        memcpy(&bytes, header + 2 * shard * sizeof(ULL), sizeof(ULL));
+        memcpy(&checksum, header + (2 * shard + 1) * sizeof(ULL), sizeof(ULL));
+        if (bytes > size - offset || fnv1a_hash(file + offset, bytes) != checksum) {
+            cout << "WARNING: checkpoint " << filename << " is corrupt (shard " << shard << ")" << endl;
+            return 0;
+        }
+        offset += bytes;
+    }
+    if (offset != size) {
+        cout << "WARNING: checkpoint " << filename << " is corrupt (trailing bytes)" << endl;
+        return 0;
+    }
+    return header_bytes;
+}
+
+// loads a checkpoint into infosets (an InfosetDict or either table),
+// reading the mapped file in place. Every shard checks out before anything
+// is loaded: false, leaving infosets untouched, if the file is missing, not
+// a checkpoint, or fails its checksums
+template<class Table>
+inline bool load_infosets_from_file_ckpt(string filename, Table &infosets) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        cout << "WARNING: no checkpoint at " << filename << endl;
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    size_t size = st.st_size;
+    if (size == 0) {
+        cout << "WARNING: " << filename << " isn't a checkpoint" << endl;
+        close(fd);
+        return false;
+    }
+    void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps the file open
+    if (data == MAP_FAILED) {
+        cout << "WARNING: could not map " << filename << endl;
+        return false;
+    }
+    madvise(data, size, MADV_SEQUENTIAL);
+    const char *file = (const char*) data;
+    ULL header_bytes = check_checkpoint(file, size, filename);
+    if (header_bytes == 0) {
+        munmap(data, size);
+        return false;
+    }
+
+    const char *p = file + header_bytes, *end = file + size;
+    vector<double> cumu_regrets, cumu_strategy;
+    while (p < end) {
+        ULL key;
+        uint32_t t;
+        uint8_t num_actions;
+        memcpy(&key, p, sizeof(key));
+        p += sizeof(key);
+        memcpy(&t, p, sizeof(t));
+        p += sizeof(t);
+        memcpy(&num_actions, p, sizeof(num_actions));
+        p += sizeof(num_actions);
+        cumu_regrets.resize(num_actions);
+        cumu_strategy.resize(num_actions);
+        for (int i = 0; i < num_actions; i++) {
+            memcpy(&cumu_regrets[i], p, sizeof(double));
+            memcpy(&cumu_strategy[i], p + sizeof(double), sizeof(double));
+            p += 2 * sizeof(double);
+        }
+        insert_checkpoint_infoset(infosets, key, t, cumu_regrets, cumu_strategy);
+    }
+    munmap(data, size);
+    return true;
+}
+
+// loads a checkpoint (.ckpt) or text file, picking by the name, so tools
+// take intermediate checkpoints as well as text tables
+template<class Table>
+inline bool load_infosets_from_file_any(string filename, Table &infosets) {
+    if (is_checkpoint_path(filename)) {
+        return load_infosets_from_file_ckpt(filename, infosets);
+    }
+    return load_infosets_from_file_fast(filename, infosets);
+}
+
+#endif
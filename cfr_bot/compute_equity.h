@@ -7,6 +7,9 @@
 #include <set>
 #include <algorithm>
 #include <unordered_map>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
 
 #include "eval7pp.h"
 #include "define.h"
@@ -308,18 +311,160 @@ inline void load_equities_from_file(string filename, EquityDict &equities) {
     infile >> equities;
 }
 
+// BucketTable = bucket of every suit-isomorphic (hand, board) class, indexed
+// by get_hand_indexer(board size), stored as one byte per class
+using BucketTable = vector<unsigned char>;
+
+// BucketTable files start with this magic, the board size and the number of
+// classes, so stale or headerless files (such as the old flop_buckets_*.bin
+// BucketDict archives) are rejected instead of read as buckets
+const char BUCKET_TABLE_MAGIC[8] = {'R', 'P', 'B', 'K', 'T', 'B', '0', '1'};
+
+// key of a (hand, flop) in BucketDict files: flop cards then hand cards, each
+// sorted by rank (descending), with suits renumbered in order of appearance,
+// as base-52 digits
+inline int flop_bucket_dict_key(ULL hand, ULL flop) {
+    int cards[5];
+    int num_cards = 0;
+    for (ULL part : {flop, hand}) {
+        int start = num_cards;
+        for (ULL bits = part; bits != 0; bits &= bits - 1) {
+            // insertion sort, ties kept in suit order
+            int card = __builtin_ctzll(bits);
+            int j = num_cards;
+            while (j > start && cards[j-1] % 13 < card % 13) {
+                cards[j] = cards[j-1];
+                j--;
+            }
+            cards[j] = card;
+            num_cards++;
+        }
+    }
+
+    int suit_iso[4] = {-1, -1, -1, -1};
+    int suit_count = 0;
+
+    int key = 0;
+    int mult = 1;
+    for (int i = 0; i < num_cards; i++) {
+        int suit = cards[i] / 13;
+        if (suit_iso[suit] == -1) {
+            suit_iso[suit] = suit_count;
+            suit_count++;
+        }
+        key += mult*(cards[i] % 13 + 13*suit_iso[suit]);
+        mult *= 52;
+    }
+    return key;
+}
+
+// flat flop table from a BucketDict, one lookup per isomorphic class. False,
+// leaving table empty, if the dict is missing any class
+inline bool flop_bucket_table_from_dict(const BucketDict &dict, BucketTable &table) {
+    const HandIndexer &indexer = get_hand_indexer(3);
+    table.assign(indexer.size(), 0);
+
+    ULL hand, flop;
+    int num_missing = 0;
+    for (ULL i = 0; i < indexer.size(); i++) {
+        indexer.unindex(i, hand, flop);
+        auto it = dict.find(flop_bucket_dict_key(hand, flop));
+        if (it == dict.end()) {
+            num_missing++;
+            continue;
+        }
+        assert(it->second >= 0 && it->second < 256); // buckets are stored in one byte
+        table[i] = it->second;
+    }
+
+    if (num_missing > 0) {
+        cout << "WARNING: " << num_missing << " flop classes missing from bucket dict" << endl;
+        table.clear();
+        return false;
+    }
+    return true;
+}
+
+// table of every class with num_board board cards. False if the file
+// couldn't be written
+inline bool save_bucket_table_to_file(string filename, const BucketTable &table,
+                                      int num_board) {
+    assert(table.size() == get_hand_indexer(num_board).size());
+    int board = num_board;
+    ULL size = table.size();
+    ofstream outfile(filename, ios::binary);
+    outfile.write(BUCKET_TABLE_MAGIC, sizeof(BUCKET_TABLE_MAGIC));
+    outfile.write((const char*)&board, sizeof(board));
+    outfile.write((const char*)&size, sizeof(size));
+    outfile.write((const char*)table.data(), table.size());
+    if (!outfile) {
+        cout << "WARNING: could not write bucket table " << filename << endl;
+        return false;
+    }
+    return true;
+}
+
+// false, leaving table empty, if the file is missing, isn't a bucket table
+// for num_board board cards or doesn't hold exactly one bucket per class
+inline bool load_bucket_table_from_file(string filename, BucketTable &table,
+                                        int num_board) {
+    table.clear();
+    ifstream infile(filename, ios::binary);
+    if (!infile) {
+        cout << "WARNING: no bucket table at " << filename << endl;
+        return false;
+    }
+
+    char magic[sizeof(BUCKET_TABLE_MAGIC)];
+    int board;
+    ULL size;
+    infile.read(magic, sizeof(magic));
+    infile.read((char*)&board, sizeof(board));
+    infile.read((char*)&size, sizeof(size));
+    if (!infile || memcmp(magic, BUCKET_TABLE_MAGIC, sizeof(magic)) != 0) {
+        cout << "WARNING: " << filename << " isn't a bucket table" << endl;
+        return false;
+    }
+    if (board != num_board || size != get_hand_indexer(num_board).size()) {
+        cout << "WARNING: bucket table " << filename << " is for " << board
+            << " board cards, not " << num_board << endl;
+        return false;
+    }
+
+    table.resize(size);
+    infile.read((char*)table.data(), size);
+    if (infile.gcount() != size || infile.peek() != EOF) {
+        cout << "WARNING: bucket table " << filename << " has the wrong size" << endl;
+        table.clear();
+        return false;
+    }
+    return true;
+}
+
 struct DataContainer {
-    BucketDict flop_buckets;
+    BucketTable flop_buckets;
     EquityClusters turn_clusters;
     EquityClusters river_clusters;
+    BucketTable turn_buckets; // precomputed turn buckets (empty = compute them)
 
     DataContainer() {}
+    // throws if the flop buckets don't cover every class, or if a turn table
+    // is named but can't be loaded: lookups index the tables unchecked
     DataContainer(
         string flop_buckets_filename, string turn_clusters_filename,
-        string river_clusters_filename) {
-        load_buckets_from_file(flop_buckets_filename, flop_buckets);
+        string river_clusters_filename, string turn_buckets_filename = "") {
+        BucketDict flop_bucket_dict;
+        load_buckets_from_file(flop_buckets_filename, flop_bucket_dict);
+        if (!flop_bucket_table_from_dict(flop_bucket_dict, flop_buckets)) {
+            throw runtime_error("Incomplete flop buckets in " + flop_buckets_filename);
+        }
+
         load_clusters_from_file(turn_clusters_filename, turn_clusters);
         load_clusters_from_file(river_clusters_filename, river_clusters);
+        if (turn_buckets_filename != "" &&
+                !load_bucket_table_from_file(turn_buckets_filename, turn_buckets, TURN_SIZE)) {
+            throw runtime_error("No turn bucket table in " + turn_buckets_filename);
+        }
     }
 };
 
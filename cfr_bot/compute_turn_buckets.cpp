@@ -0,0 +1,37 @@
+#include <chrono>
+#include <thread>
+#include "cfr.h"
+
+using namespace std;
+using namespace std::chrono;
+
+string DATA_PATH = "../../data/equity_data/";
+
+// usage: compute_turn_buckets <clusters name> <table name> [threads]
+// e.g. compute_turn_buckets turn_clusters_150 turn_buckets_150
+int main(int argc, char *argv[]) {
+
+    EquityClusters turn_clusters;
+    BucketTable turn_buckets;
+
+    string clusters_path = DATA_PATH + argv[1] + ".txt";
+    string save_path = DATA_PATH + argv[2] + ".bin";
+    int num_threads = (argc > 3) ? atoi(argv[3]) : thread::hardware_concurrency();
+
+    load_clusters_from_file(clusters_path, turn_clusters);
+    cout << "Loaded " << turn_clusters.size() << " clusters from " << clusters_path << endl;
+
+    auto start = high_resolution_clock::now();
+    compute_bucket_table(turn_buckets, TURN_SIZE, turn_clusters, num_threads);
+    auto stop = high_resolution_clock::now();
+    auto duration = duration_cast<seconds>(stop - start);
+
+    cout << "Computed " << turn_buckets.size() << " turn buckets in " << duration.count() << " s." << endl;
+
+    if (!save_bucket_table_to_file(save_path, turn_buckets, TURN_SIZE)) {
+        return 1;
+    }
+    cout << "Saved to " << save_path << endl;
+
+    return 0;
+}
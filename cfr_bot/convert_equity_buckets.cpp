@@ -7,12 +7,20 @@ using namespace std::chrono;
 
 string DATA_PATH = "../../data/equity_data/";
 
+// flattens a flop BucketDict into a BucketTable file for the bot. The table
+// gets its own name: flop_buckets_*.bin used to hold BucketDict archives
+// usage: convert_equity_buckets <buckets name> <table name>
+// e.g. convert_equity_buckets flop_buckets_150 flop_bucket_table_150
 int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        cout << "usage: convert_equity_buckets <buckets name> <table name>" << endl;
+        return 1;
+    }
 
     BucketDict flop_buckets;
 
     string load_path = DATA_PATH + argv[1] + ".txt";
-    string save_path = DATA_PATH + argv[1] + ".bin";
+    string save_path = DATA_PATH + argv[2] + ".bin";
 
     // load equity buckets from text file
     cout << "Loading from " << load_path << endl;
@@ -24,21 +32,37 @@ int main(int argc, char *argv[]) {
 
     cout << "Loaded " << flop_buckets.size() << " in " << duration.count() << " ms." << endl;
 
-    // save equity buckets to binary
+    // flatten to one bucket per isomorphic flop class
+    BucketTable flop_table;
     start = high_resolution_clock::now();
-    save_buckets_to_file_bin(save_path, flop_buckets);
+    if (!flop_bucket_table_from_dict(flop_buckets, flop_table)) {
+        cout << "Not saving a partial table." << endl;
+        return 1;
+    }
+    stop = high_resolution_clock::now();
+    duration = duration_cast<milliseconds>(stop - start);
+
+    cout << "Flattened to " << flop_table.size() << " classes in " << duration.count() << " ms." << endl;
+
+    // save flat table to binary
+    start = high_resolution_clock::now();
+    if (!save_bucket_table_to_file(save_path, flop_table, FLOP_SIZE)) {
+        return 1;
+    }
     stop = high_resolution_clock::now();
     duration = duration_cast<milliseconds>(stop - start);
 
     cout << "Saved to " << save_path << " in " << duration.count() << " ms." << endl;
 
-    // re-load equity buckets from binary to check load time
+    // re-load flat table from binary to check load time
     start = high_resolution_clock::now();
-    load_buckets_from_file_bin(save_path, &flop_buckets);
+    if (!load_bucket_table_from_file(save_path, flop_table, FLOP_SIZE)) {
+        return 1;
+    }
     stop = high_resolution_clock::now();
     duration = duration_cast<milliseconds>(stop - start);
 
-    cout << "Re-loaded " << flop_buckets.size() << " from binary in " << duration.count() << " ms." << endl;
+    cout << "Re-loaded " << flop_table.size() << " from binary in " << duration.count() << " ms." << endl;
 
     return 0;
 }
\ No newline at end of file
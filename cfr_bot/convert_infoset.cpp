@@ -1,30 +1,44 @@
 #include <chrono>
 #include "cfr.h"
 #include "binary.h"
+#include "checkpoint.h"
+#include "mapped_infosets.h"
 
 using namespace std;
 using namespace std::chrono;
 
 string DATA_PATH = "../../data/cfr_data/";
 
+// usage: convert_infoset <name>, converting <name>.txt, or the checkpoint
+// <name>.ckpt if there is no text file (also saved as <name>.txt then, for
+// the analysis scripts)
 int main(int argc, char *argv[]) {
 
     InfosetDict infosets;
 
-    string load_path = DATA_PATH + argv[1] + ".txt";
+    string text_path = DATA_PATH + argv[1] + ".txt";
+    string checkpoint_path = DATA_PATH + argv[1] + ".ckpt";
+    bool from_checkpoint = !ifstream(text_path).good() && ifstream(checkpoint_path).good();
+    string load_path = from_checkpoint ? checkpoint_path : text_path;
     string save_path = DATA_PATH + argv[1] + ".bin";
     string save_path_pure = DATA_PATH + argv[1] + ".bin.pure";
+    string save_path_mapped = DATA_PATH + argv[1] + ".map";
 
-    // load infosets from text file
+    // load infosets from text file (or checkpoint)
     cout << "Loading from " << load_path << endl;
 
     auto start = high_resolution_clock::now();
-    load_infosets_from_file(load_path, infosets);
+    load_infosets_from_file_any(load_path, infosets);
     auto stop = high_resolution_clock::now();
     auto duration = duration_cast<milliseconds>(stop - start);
 
     cout << "Loaded " << infosets.size() << " in " << duration.count() << " ms." << endl;
 
+    if (from_checkpoint) {
+        save_infosets_to_file(text_path, infosets);
+        cout << "Saved to " << text_path << " (text)." << endl;
+    }
+
     // convert full CFR infoset to purified infoset
     InfosetDictPure infosets_pure;
     int pruned = 0;
@@ -72,5 +86,21 @@ int main(int argc, char *argv[]) {
 
     cout << "Re-loaded " << infosets_pure.size() << " from binary in " << duration.count() << " ms (purified)." << endl;
 
+    // save purified infosets for the bot to map (see mapped_infosets.h)
+    start = high_resolution_clock::now();
+    save_infosets_to_file_mapped(save_path_mapped, infosets_pure);
+    stop = high_resolution_clock::now();
+    duration = duration_cast<milliseconds>(stop - start);
+
+    cout << "Saved to " << save_path_mapped << " in " << duration.count() << " ms (mapped)." << endl;
+
+    // open it as the bot does
+    start = high_resolution_clock::now();
+    MappedInfosets infosets_mapped(save_path_mapped);
+    stop = high_resolution_clock::now();
+    auto duration_us = duration_cast<microseconds>(stop - start);
+
+    cout << "Mapped " << infosets_mapped.size() << " in " << duration_us.count() << " us." << endl;
+
     return 0;
 }
\ No newline at end of file
@@ -15,6 +15,13 @@ using namespace std;
 // shorthand for long type names
 using ULL = unsigned long long;
 
+// cards held and on the board by street (here so the bucket tables in
+// compute_equity.h can be sized without game.h)
+const int HAND_SIZE = 2;
+const int FLOP_SIZE = 3;
+const int TURN_SIZE = 4;
+const int BOARD_SIZE = 5;
+
 // define fixed ranges for k-means
 constexpr int NUM_RANGES = 8;
 extern const int NUM_RANGE[8];
@@ -89,6 +96,41 @@ inline bool in_set(const unordered_set<T>& v, const T& elt) {
     return v.find(elt) != v.end();
 }
 
+//////// suit-isomorphic hand indexing ////////
+
+// dense index of (2 hole cards, num_board board cards) up to suit
+// isomorphism, in [0, size()). Each suit is described by the ranks it holds
+// in the hole and on the board, and a hand's class is the multiset of the
+// four descriptions. Classes are ranked first by suit configuration (how many
+// hole and board cards each suit has, sorted), then within it by the multiset
+// of descriptions of each group of suits sharing a count. index() and
+// unindex() don't allocate
+struct HandIndexer {
+    int num_board;
+    ULL num_indices;
+
+    // per configuration: code (hole*6 + board cards) of each suit, sorted
+    // descending, and the first index of the configuration
+    vector<array<int, 4>> config_codes;
+    vector<ULL> config_offsets;
+    vector<short> config_ids; // configuration by base-18 key of its codes
+
+    explicit HandIndexer(int num_board);
+
+    ULL size() const {
+        return num_indices;
+    }
+
+    ULL index(ULL hole, ULL board) const;
+
+    // a representative of the class: its suits are numbered in the order
+    // index() sorts them, so index(hole, board) gives back the index
+    void unindex(ULL index, ULL &hole, ULL &board) const;
+};
+
+// shared indexers, built on first use (num_board = 0, 3, 4 or 5)
+const HandIndexer& get_hand_indexer(int num_board);
+
 extern const string suits[];
 extern const string ranks[];
 inline string pretty_card(int c) {
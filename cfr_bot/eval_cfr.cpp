@@ -8,6 +8,7 @@
 #include "eval7pp.h"
 
 #include "cfr.h"
+#include "checkpoint.h"
 #include "compute_equity.h"
 #include "define.h"
 
@@ -23,6 +24,7 @@ int N_EVAL_ITER = 50;
 InfosetDict infosets1, infosets2;
 
 string DATA_PATH = "../../data/";
+// text tables or checkpoints (.ckpt), see main
 string infosets1_path = DATA_PATH + "cfr_data/dev1.txt";
 string infosets2_path = DATA_PATH + "cfr_data/dev2.txt";
 
@@ -186,12 +188,12 @@ pair<double,double> bootstrap(const vector<double>& vals, int n_boot) {
 void eval_cfr(const DataContainer& data1, const DataContainer& data2) {
     ifstream infosets1_file(infosets1_path);
     if (infosets1_file.good()) {
-        load_infosets_from_file(infosets1_path, infosets1);
+        load_infosets_from_file_any(infosets1_path, infosets1);
     }
     cout << "Infosets1 count " << infosets1.size() << endl;
     ifstream infosets2_file(infosets2_path);
     if (infosets2_file.good()) {
-        load_infosets_from_file(infosets2_path, infosets2);
+        load_infosets_from_file_any(infosets2_path, infosets2);
     }
     cout << "Infosets2 count " << infosets2.size() << endl;
 
@@ -214,7 +216,12 @@ void eval_cfr(const DataContainer& data1, const DataContainer& data2) {
 }
 
 
-int main() {
+// usage: eval_cfr [infosets1 infosets2]
+int main(int argc, char *argv[]) {
+    if (argc > 2) {
+        infosets1_path = argv[1];
+        infosets2_path = argv[2];
+    }
 
     // different data for each player in case we change bucketing
     DataContainer data1(
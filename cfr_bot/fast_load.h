@@ -0,0 +1,398 @@
+#ifndef REAL_POKER_FAST_LOAD
+#define REAL_POKER_FAST_LOAD
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "batch_queue.h"
+#include "cfr.h"
+#include "gametree.h"
+
+using namespace std;
+
+// parallel loader for the text infoset format (see operator<< in cfr.h),
+// reading the same files as load_infosets_from_file. The file is mapped
+// instead of streamed, split at line boundaries into one chunk per thread,
+// and each thread parses its lines by hand (no getline or istringstream,
+// nothing allocated per line) and inserts them into a table sized up front.
+// Lines that don't parse are skipped and counted instead of ending the load
+
+// exact powers of ten that doubles hold exactly (up to 10^22)
+const double FAST_LOAD_POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+inline bool is_number_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char* skip_number_spaces(const char *p, const char *end) {
+    while (p < end && is_number_space(*p)) {
+        p++;
+    }
+    return p;
+}
+
+// unsigned integer at p into value; the character after it, or nullptr if
+// there are no digits
+inline const char* parse_ull(const char *p, const char *end, ULL &value) {
+    const char *start = p;
+    value = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = 10*value + (*p - '0');
+        p++;
+    }
+    return (p == start) ? nullptr : p;
+}
+
+// double at p into value, rounded as strtod would. Numbers of at most 15
+// significant digits and small exponents, such as the 6 digits
+// save_infosets_to_file writes, are one multiply or divide of exact values
+// (so correctly rounded); anything longer goes to strtod
+inline const char* parse_double(const char *p, const char *end, double &value) {
+    const char *start = p;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    ULL mantissa = 0;
+    int num_digits = 0, exponent = 0;
+    bool any_digits = false;
+    for (; p < end && *p >= '0' && *p <= '9'; p++) {
+        any_digits = true;
+        if (mantissa != 0 || *p != '0') {
+            mantissa = 10*mantissa + (*p - '0');
+            num_digits++;
+        }
+        if (num_digits > 15) {
+            break;
+        }
+    }
+    if (num_digits <= 15 && p < end && *p == '.') {
+        for (p++; p < end && *p >= '0' && *p <= '9'; p++) {
+            any_digits = true;
+            if (mantissa != 0 || *p != '0') {
+                mantissa = 10*mantissa + (*p - '0');
+                num_digits++;
+            }
+            exponent--;
+            if (num_digits > 15) {
+                break;
+            }
+        }
+    }
+    if (num_digits <= 15 && any_digits && p < end && (*p == 'e' || *p == 'E')) {
+        const char *after_e = p + 1;
+        bool negative_exponent = false;
+        if (after_e < end && (*after_e == '-' || *after_e == '+')) {
+            negative_exponent = (*after_e == '-');
+            after_e++;
+        }
+        ULL e;
+        const char *after_exponent = parse_ull(after_e, end, e);
+        if (after_exponent != nullptr && e < 1000) {
+            exponent += negative_exponent ? -(int) e : (int) e;
+            p = after_exponent;
+        }
+    }
+
+    bool fast = any_digits && num_digits <= 15 && exponent >= -22 && exponent <= 22
+        && (p == end || is_number_space(*p) || *p == '\n');
+    if (fast) {
+        value = (double) mantissa;
+        value = (exponent < 0) ? value / FAST_LOAD_POWERS_OF_TEN[-exponent]
+                               : value * FAST_LOAD_POWERS_OF_TEN[exponent];
+        if (negative) {
+            value = -value;
+        }
+        return p;
+    }
+
+    // long mantissas, large exponents, inf and nan
+    const char *token_end = start;
+    while (token_end < end && !is_number_space(*token_end) && *token_end != '\n') {
+        token_end++;
+    }
+    string token(start, token_end);
+    char *parsed_end;
+    value = strtod(token.c_str(), &parsed_end);
+    if (parsed_end != token.c_str() + token.size() || token.empty()) {
+        return nullptr;
+    }
+    return token_end;
+}
+
+// the line in [p, end) (up to but not including '\n'): key, t, then
+// (regret, strategy sum) pairs. False if it doesn't parse
+inline bool parse_infoset_line(const char *p, const char *end, ULL &key, int &t,
+                               vector<double> &cumu_regrets,
+                               vector<double> &cumu_strategy) {
+    cumu_regrets.clear();
+    cumu_strategy.clear();
+
+    ULL count;
+    p = parse_ull(skip_number_spaces(p, end), end, key);
+    if (p == nullptr || p == end || !is_number_space(*p)) {
+        return false;
+    }
+    p = parse_ull(skip_number_spaces(p, end), end, count);
+    if (p == nullptr) {
+        return false;
+    }
+    t = count;
+
+    while ((p = skip_number_spaces(p, end)) < end) {
+        double regret, strategy;
+        p = parse_double(p, end, regret);
+        if (p == nullptr) {
+            return false;
+        }
+        p = parse_double(skip_number_spaces(p, end), end, strategy);
+        if (p == nullptr) {
+            return false;
+        }
+        cumu_regrets.push_back(regret);
+        cumu_strategy.push_back(strategy);
+    }
+    return !cumu_regrets.empty() && cumu_regrets.size() <= MAX_ACTIONS;
+}
+
+// one thread's share of a mapped file: whole lines in [begin, end)
+struct FastLoadChunk {
+    int index; // chunks are numbered in file order
+    const char *begin;
+    const char *end;
+    ULL num_lines = 0;
+    ULL num_malformed = 0;
+    ULL num_skipped = 0; // parsed, but not taken by the table
+};
+
+// calls f(key, t, cumu_regrets, cumu_strategy) for each line of chunk that
+// parses, counting those that don't. Blank lines are ignored
+template<class F>
+inline void for_each_infoset_line(FastLoadChunk &chunk, F f) {
+    ULL key;
+    int t;
+    vector<double> cumu_regrets, cumu_strategy;
+    cumu_regrets.reserve(MAX_ACTIONS);
+    cumu_strategy.reserve(MAX_ACTIONS);
+    for (const char *line = chunk.begin; line < chunk.end; ) {
+        const char *line_end = (const char*) memchr(line, '\n', chunk.end - line);
+        if (line_end == nullptr) {
+            line_end = chunk.end;
+        }
+        if (skip_number_spaces(line, line_end) != line_end) {
+            if (parse_infoset_line(line, line_end, key, t, cumu_regrets, cumu_strategy)) {
+                f(key, t, cumu_regrets, cumu_strategy);
+            }
+            else {
+                chunk.num_malformed++;
+            }
+        }
+        line = line_end + 1;
+    }
+}
+
+// maps filename and splits it into num_threads chunks of whole lines, then
+// runs prepare(total number of lines) and load(chunk) on every chunk, each
+// chunk on its own thread. False if the file can't be read
+inline bool run_fast_load(string filename, int num_threads,
+                          const function<void(ULL)> &prepare,
+                          const function<void(FastLoadChunk&)> &load) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        cout << "WARNING: could not read infosets from " << filename << endl;
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    size_t size = st.st_size;
+    if (size == 0) {
+        close(fd);
+        prepare(0);
+        return true;
+    }
+    void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps the file open
+    if (data == MAP_FAILED) {
+        cout << "WARNING: could not map " << filename << endl;
+        return false;
+    }
+    madvise(data, size, MADV_SEQUENTIAL);
+    const char *file = (const char*) data, *file_end = file + size;
+
+    // chunk boundaries move forward to the start of the next line
+    int num_chunks = max(num_threads, 1);
+    vector<FastLoadChunk> chunks(num_chunks);
+    const char *begin = file;
+    for (int i = 0; i < num_chunks; i++) {
+        const char *end = file + size * (i + 1) / num_chunks;
+        if (end < begin) {
+            end = begin;
+        }
+        if (end < file_end) {
+            const char *newline = (const char*) memchr(end, '\n', file_end - end);
+            end = (newline == nullptr) ? file_end : newline + 1;
+        }
+        chunks[i].index = i;
+        chunks[i].begin = begin;
+        chunks[i].end = end;
+        begin = end;
+    }
+
+    auto run_chunks = [&chunks](const function<void(FastLoadChunk&)> &f) {
+        vector<thread> threads;
+        for (int i = 1; i < chunks.size(); i++) {
+            threads.push_back(thread(f, ref(chunks[i])));
+        }
+        f(chunks[0]);
+        for (thread &t : threads) {
+            t.join();
+        }
+    };
+
+    // lines are counted first so the table is sized once
+    run_chunks([](FastLoadChunk &chunk) {
+        for (const char *p = chunk.begin; p < chunk.end; p++) {
+            p = (const char*) memchr(p, '\n', chunk.end - p);
+            chunk.num_lines++;
+            if (p == nullptr) {
+                break;
+            }
+        }
+    });
+    ULL num_lines = 0;
+    for (FastLoadChunk &chunk : chunks) {
+        num_lines += chunk.num_lines;
+    }
+    prepare(num_lines);
+    run_chunks(load);
+    munmap(data, size);
+
+    ULL num_malformed = 0, num_skipped = 0;
+    for (FastLoadChunk &chunk : chunks) {
+        num_malformed += chunk.num_malformed;
+        num_skipped += chunk.num_skipped;
+    }
+    if (num_malformed > 0) {
+        cout << "WARNING: skipped " << num_malformed << " malformed lines in " << filename << endl;
+    }
+    if (num_skipped > 0) {
+        cout << "WARNING: skipped " << num_skipped << " infosets the table doesn't hold" << endl;
+    }
+    return true;
+}
+
+// parsed infosets handed from a chunk's thread to the one filling an
+// InfosetDict, in batches of this many (a few batches per chunk in flight)
+const int FAST_LOAD_DICT_BATCH = 4096;
+const int FAST_LOAD_DICT_QUEUE = 4;
+
+// loads filename into infosets with num_threads threads, adding to (or
+// overwriting) what is there. False if the file can't be read
+
+// InfosetDict isn't thread safe, so one thread fills it while the others
+// parse: each chunk's infosets reach it through the chunk's own bounded
+// queue, taken chunk by chunk so later lines overwrite earlier ones as they
+// would with load_infosets_from_file. Filling the dict is the slow part and
+// overlaps the parsing, and only a few batches per chunk are held
+// besides the dict. With one thread, lines go straight into the dict
+inline bool load_infosets_from_file_fast(string filename, InfosetDict &infosets,
+                                         int num_threads = thread::hardware_concurrency()) {
+    if (num_threads <= 1) {
+        return run_fast_load(filename, 1, [&infosets](ULL num_lines) {
+            infosets.reserve(infosets.size() + num_lines);
+        }, [&infosets](FastLoadChunk &chunk) {
+            for_each_infoset_line(chunk, [&infosets](ULL key, int t, const vector<double> &cumu_regrets,
+                                                     const vector<double> &cumu_strategy) {
+                infosets[key] = CFRInfoset(cumu_regrets, cumu_strategy, t);
+            });
+        });
+    }
+
+    using Parsed = pair<ULL, CFRInfoset>;
+    vector<unique_ptr<BatchQueue<Parsed>>> queues;
+    for (int i = 0; i < num_threads; i++) {
+        queues.emplace_back(new BatchQueue<Parsed>(FAST_LOAD_DICT_QUEUE));
+    }
+    thread filler;
+    bool ok = run_fast_load(filename, num_threads, [&infosets, &queues, &filler](ULL num_lines) {
+        infosets.reserve(infosets.size() + num_lines);
+        filler = thread([&infosets, &queues]() {
+            vector<Parsed> batch;
+            for (auto &queue : queues) {
+                while (queue->pop(batch)) {
+                    for (Parsed &kv : batch) {
+                        infosets[kv.first] = move(kv.second);
+                    }
+                }
+            }
+        });
+    }, [&queues](FastLoadChunk &chunk) {
+        BatchQueue<Parsed> &queue = *queues[chunk.index];
+        vector<Parsed> batch;
+        batch.reserve(FAST_LOAD_DICT_BATCH);
+        for_each_infoset_line(chunk, [&queue, &batch](ULL key, int t, const vector<double> &cumu_regrets,
+                                                      const vector<double> &cumu_strategy) {
+            batch.push_back(make_pair(key, CFRInfoset(cumu_regrets, cumu_strategy, t)));
+            if (batch.size() == FAST_LOAD_DICT_BATCH) {
+                queue.push(batch); // waits while the filler is behind
+            }
+        });
+        if (!batch.empty()) {
+            queue.push(batch);
+        }
+        queue.close();
+    });
+    // an empty file has no chunks to close them
+    for (auto &queue : queues) {
+        queue->close();
+    }
+    if (filler.joinable()) {
+        filler.join();
+    }
+    return ok;
+}
+
+// InfosetTable takes concurrent fetches once it has room for every line
+template<class Storage>
+inline bool load_infosets_from_file_fast(string filename, InfosetTableT<Storage> &infosets,
+                                         int num_threads = thread::hardware_concurrency()) {
+    return run_fast_load(filename, num_threads, [&infosets](ULL num_lines) {
+        infosets.reserve(infosets.size() + num_lines);
+    }, [&infosets](FastLoadChunk &chunk) {
+        for_each_infoset_line(chunk, [&infosets](ULL key, int t, const vector<double> &cumu_regrets,
+                                                 const vector<double> &cumu_strategy) {
+            infosets.insert_concurrent(key, t, cumu_regrets, cumu_strategy);
+        });
+    });
+}
+
+// DenseInfosetTable entries are fixed, so threads write them directly
+template<class Storage>
+inline bool load_infosets_from_file_fast(string filename, DenseInfosetTableT<Storage> &infosets,
+                                         int num_threads = thread::hardware_concurrency()) {
+    return run_fast_load(filename, num_threads, [](ULL num_lines) {}, [&infosets](FastLoadChunk &chunk) {
+        for_each_infoset_line(chunk, [&infosets, &chunk](ULL key, int t, const vector<double> &cumu_regrets,
+                                                         const vector<double> &cumu_strategy) {
+            if (!infosets.insert(key, t, cumu_regrets, cumu_strategy)) {
+                chunk.num_skipped++;
+            }
+        });
+    });
+}
+
+#endif
@@ -24,10 +24,9 @@ const vector<float> BET_SIZES = {0.33, 0.67, 1.5, 3, 100}; // 5 bet sizes, 100 =
 const int RAISE = 3 + BET_SIZES.size();
 const vector<float> RAISE_SIZES = {1, 3, 6, 10, 100}; // 5 raise sizes, 100 = all-in
 
-const int HAND_SIZE = 2;
-const int FLOP_SIZE = 3;
-const int TURN_SIZE = 4;
-const int BOARD_SIZE = 5;
+// most actions available at once: check/call, fold and 5 bet or raise sizes
+const int MAX_ACTIONS = 7;
+
 const int NUM_STREETS = 4;
 
 const int BIG_BLIND_ = 2;
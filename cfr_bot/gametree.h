@@ -65,6 +65,335 @@ inline GameTreeNode build_game_tree(BoardActionHistory history) {
 
 }
 
+// one node of a FlatGameTree (fields as in GameTreeNode)
+struct FlatGameNode {
+    ULL history_key;
+    int won;
+    int first_child; // children are nodes[first_child, first_child + num_children)
+    // decision nodes: first of the node's num_children action slots, counted
+    // over the decision nodes of its street in tree order (see FlatGameTree)
+    int action_base;
+    int decision_index; // decision nodes: index among its street's decision nodes
+    unsigned char num_children;
+    unsigned char ind;
+    unsigned char street;
+    bool finished;
+    bool showdown;
+};
+
+inline ostream& operator<<(ostream& os, const FlatGameNode& p) {
+    os << "FlatGameNode(key=" << p.history_key << ",";
+    os << "num_children=" << (int) p.num_children << ",";
+    os << "street=" << (int) p.street << ",";
+    os << "finished=" << p.finished << ",";
+    os << "showdown=" << p.showdown << ")";
+    return os;
+}
+
+// game tree in one contiguous array: the root is nodes[0] and each node's
+// children sit next to each other, with sibling groups laid out depth first.
+// A traversal walks array indices instead of chasing per-node child vectors.
+// Decision nodes are numbered per street, as are their actions, so an
+// infoset (node, card info) can be addressed densely (see DenseInfosetTableT)
+struct FlatGameTree {
+    vector<FlatGameNode> nodes;
+    array<int, NUM_STREETS> num_action_slots = {}; // per street
+    array<int, NUM_STREETS> num_decisions = {}; // per street
+
+    FlatGameTree() {}
+
+    explicit FlatGameTree(const BoardActionHistory &history) {
+        nodes.push_back(make_node(history));
+        add_children(0, history);
+    }
+
+    const FlatGameNode& root() const { return nodes[0]; }
+    const FlatGameNode& child(const FlatGameNode &node, int i) const {
+        return nodes[node.first_child + i];
+    }
+
+private:
+    static FlatGameNode make_node(const BoardActionHistory &history) {
+        FlatGameNode node;
+        node.history_key = info_to_key(history.ind ^ history.button, history.street, 0, history);
+        node.won = history.won[0];
+        node.first_child = 0;
+        node.action_base = 0;
+        node.decision_index = 0;
+        node.num_children = 0;
+        node.ind = history.ind;
+        node.street = history.street;
+        node.finished = history.finished;
+        node.showdown = history.showdown;
+        return node;
+    }
+
+    void add_children(int index, const BoardActionHistory &history) {
+        vector<int> available_actions = history.get_available_actions();
+        assert(available_actions.size() > 0 || history.finished);
+        assert(available_actions.size() <= MAX_ACTIONS);
+        if (available_actions.size() == 0) {
+            return;
+        }
+
+        int first_child = nodes.size();
+        FlatGameNode &node = nodes[index];
+        node.first_child = first_child;
+        node.num_children = available_actions.size();
+        node.action_base = num_action_slots[node.street];
+        num_action_slots[node.street] += available_actions.size();
+        node.decision_index = num_decisions[node.street]++;
+
+        vector<BoardActionHistory> child_histories;
+        for (int i = 0; i < available_actions.size(); i++) {
+            child_histories.push_back(history);
+            child_histories[i].update(available_actions[i]);
+            nodes.push_back(make_node(child_histories[i]));
+        }
+        for (int i = 0; i < available_actions.size(); i++) {
+            add_children(first_child + i, child_histories[i]);
+        }
+    }
+};
+
+// regret storage addressed directly by (tree node, card info) instead of by
+// hashing the infoset key, so fetching is a multiply-add. Every infoset of the
+// tree has a fixed entry (laid out as in InfosetTable: t, regrets, strategy
+// sums), ordered by street, then card info, then decision node, so one deal's
+// infosets on a street sit together. Entries are made up front for every card
+// info, visited or not: with 150 buckets after the flop that is 3.6M
+// infosets, 181MB as doubles. Nothing is allocated while training, so many
+// threads can fetch at once (updates are Hogwild, as in InfosetTable).
+// Infoset keys are still used to load, save and export (same formats as
+// InfosetTable), through a map from history key to decision node
+template<class Storage>
+struct DenseInfosetTableT {
+    using Value = typename Storage::value_type;
+    using Ref = CFRInfosetRefT<Storage>;
+
+    // one decision node, whose infosets are at offset in each card info block
+    struct Decision {
+        ULL history_key;
+        int num_actions;
+        int offset;
+    };
+
+    array<int, NUM_STREETS> num_card_infos = {};
+    array<ULL, NUM_STREETS> street_offset = {}; // first value of each street
+    array<ULL, NUM_STREETS> card_info_stride = {}; // values per card info block
+    array<vector<Decision>, NUM_STREETS> decisions; // by decision_index
+    unordered_map<ULL, pair<int, int>> decision_of_key; // (street, decision_index)
+    vector<Value> values;
+
+    DenseInfosetTableT() {}
+
+    // entries for every decision node of tree, with num_card_infos[street]
+    // card infos per street (see get_num_card_infos)
+    DenseInfosetTableT(const FlatGameTree &tree, const array<int, NUM_STREETS> &init_num_card_infos)
+        : num_card_infos(init_num_card_infos) {
+        ULL num_values = 0;
+        for (int street = 0; street < NUM_STREETS; street++) {
+            assert(num_card_infos[street] > 0 && num_card_infos[street] <= (1 << SHIFT_CARD_INFO));
+            decisions[street].resize(tree.num_decisions[street]);
+            street_offset[street] = num_values;
+            card_info_stride[street] = tree.num_decisions[street] + 2*tree.num_action_slots[street];
+            num_values += num_card_infos[street] * card_info_stride[street];
+        }
+        for (const FlatGameNode &node : tree.nodes) {
+            if (node.num_children == 0) {
+                continue;
+            }
+            Decision &decision = decisions[node.street][node.decision_index];
+            decision.history_key = node.history_key;
+            decision.num_actions = node.num_children;
+            decision.offset = node.decision_index + 2*node.action_base;
+            decision_of_key[node.history_key] = make_pair((int) node.street, node.decision_index);
+        }
+        values.assign(num_values, Value());
+    }
+
+    // the infoset of a decision node for the acting player's card info
+    Ref at(const FlatGameNode &node, int card_info) {
+        assert(node.num_children > 0);
+        assert(card_info >= 0 && card_info < num_card_infos[node.street]);
+        return Ref(&values[street_offset[node.street] + card_info * card_info_stride[node.street]
+                           + node.decision_index + 2*node.action_base],
+                   node.num_children);
+    }
+
+    // true if tree's decision nodes are laid out as the one the table was
+    // built from (e.g. the other button position's tree)
+    bool covers(const FlatGameTree &tree) const {
+        for (const FlatGameNode &node : tree.nodes) {
+            if (node.num_children == 0) {
+                continue;
+            }
+            if (node.decision_index >= decisions[node.street].size()) {
+                return false;
+            }
+            const Decision &decision = decisions[node.street][node.decision_index];
+            if (decision.history_key != node.history_key
+                || decision.num_actions != node.num_children
+                || decision.offset != node.decision_index + 2*node.action_base) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // number of infosets with an entry, visited or not
+    ULL num_entries() const {
+        ULL n = 0;
+        for (int street = 0; street < NUM_STREETS; street++) {
+            n += (ULL) num_card_infos[street] * decisions[street].size();
+        }
+        return n;
+    }
+
+    // number of visited infosets (those saved and exported)
+    ULL size() {
+        ULL n = 0;
+        for_each_visited([&n](ULL key, Ref infoset) { n++; });
+        return n;
+    }
+
+    // bytes held by the entries (the key map only has one item per decision node)
+    ULL memory_bytes() const { return values.size() * sizeof(Value); }
+
+    // false if the key isn't in the tree or the infoset hasn't been visited,
+    // as if it wasn't stored
+    bool find(ULL key, Ref &infoset) {
+        if (!find_entry(key, infoset)) {
+            return false;
+        }
+        return infoset.t() > 0;
+    }
+
+    // zero every entry
+    void clear() { fill(values.begin(), values.end(), Value()); }
+
+    // set an infoset, e.g. when loading from file. False if the key isn't in
+    // the tree (a checkpoint from another tree or bucketing)
+    bool insert(ULL key, int t, const vector<double> &cumu_regrets,
+                const vector<double> &cumu_strategy) {
+        assert(cumu_regrets.size() == cumu_strategy.size());
+        Ref infoset;
+        if (!find_entry(key, infoset) || infoset.num_actions != cumu_regrets.size()) {
+            return false;
+        }
+        infoset.set_t(t);
+        for (int i = 0; i < infoset.num_actions; i++) {
+            infoset.cumu_regrets()[i] = Storage::store(cumu_regrets[i]);
+            infoset.cumu_strategy()[i] = Storage::store(cumu_strategy[i]);
+        }
+        return true;
+    }
+
+    // card info blocks (one per street and card info), in the order
+    // for_each_visited goes through them
+    ULL num_blocks() const {
+        ULL n = 0;
+        for (int street = 0; street < NUM_STREETS; street++) {
+            n += num_card_infos[street];
+        }
+        return n;
+    }
+
+    // calls f(key, infoset) for every visited infoset in blocks [begin, end),
+    // so that separate threads can go through separate blocks
+    template<class F>
+    void for_each_visited(F f, ULL begin = 0, ULL end = ~0ULL) {
+        ULL block = 0;
+        for (int street = 0; street < NUM_STREETS; street++) {
+            for (int card_info = 0; card_info < num_card_infos[street]; card_info++, block++) {
+                if (block < begin || block >= end) {
+                    continue;
+                }
+                for (const Decision &decision : decisions[street]) {
+                    Ref infoset = entry(street, card_info, decision);
+                    if (infoset.t() > 0) {
+                        f(info_to_key(decision.history_key, card_info), infoset);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    Ref entry(int street, int card_info, const Decision &decision) {
+        return Ref(&values[street_offset[street] + card_info * card_info_stride[street] + decision.offset],
+                   decision.num_actions);
+    }
+
+    bool find_entry(ULL key, Ref &infoset) {
+        const ULL card_info_mask = ((1ULL << SHIFT_CARD_INFO) - 1) << SHIFT_CARD_INFO_TOTAL;
+        auto it = decision_of_key.find(key & ~card_info_mask);
+        if (it == decision_of_key.end()) {
+            return false;
+        }
+        int street = it->second.first;
+        int card_info = (key & card_info_mask) >> SHIFT_CARD_INFO_TOTAL;
+        if (card_info >= num_card_infos[street]) {
+            return false;
+        }
+        infoset = entry(street, card_info, decisions[street][it->second.second]);
+        return true;
+    }
+};
+
+using DenseInfosetTable = DenseInfosetTableT<RegretStorage>;
+
+// same text format as InfosetDict (visited infosets only)
+template<class Storage>
+inline ostream& operator<<(ostream& os, DenseInfosetTableT<Storage>& p) {
+    p.for_each_visited([&os](ULL key, CFRInfosetRefT<Storage> infoset) {
+        os << key << " ";
+        os << infoset.t() << " ";
+        for (int i = 0; i < infoset.num_actions; i++) {
+            os << infoset.regret(i) << " ";
+            os << infoset.strategy_sum(i) << " ";
+        }
+        os << endl;
+    });
+    return os;
+}
+
+template<class Storage>
+inline istream& operator>>(istream &in, DenseInfosetTableT<Storage>& p)
+{
+    ULL key;
+    int t;
+    vector<double> cumu_regrets;
+    vector<double> cumu_strategy;
+    ULL num_skipped = 0;
+
+    while (read_infoset_line(in, key, t, cumu_regrets, cumu_strategy)) {
+        if (!p.insert(key, t, cumu_regrets, cumu_strategy)) {
+            num_skipped++;
+        }
+    }
+    if (num_skipped > 0) {
+        cout << "WARNING: skipped " << num_skipped << " infosets not in the dense table" << endl;
+    }
+
+    return in;
+}
+
+// visited infosets as an InfosetDict, keyed as in training with InfosetTable
+template<class Storage>
+inline InfosetDict infoset_table_to_dict(DenseInfosetTableT<Storage> &infosets) {
+    InfosetDict dict;
+    infosets.for_each_visited([&dict](ULL key, CFRInfosetRefT<Storage> infoset) {
+        vector<double> cumu_regrets(infoset.num_actions), cumu_strategy(infoset.num_actions);
+        for (int i = 0; i < infoset.num_actions; i++) {
+            cumu_regrets[i] = infoset.regret(i);
+            cumu_strategy[i] = infoset.strategy_sum(i);
+        }
+        dict[key] = CFRInfoset(cumu_regrets, cumu_strategy, infoset.t());
+    });
+    return dict;
+}
+
 
 
 #endif
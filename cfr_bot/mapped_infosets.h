@@ -0,0 +1,153 @@
+#ifndef REAL_POKER_MAPPED_INFOSETS
+#define REAL_POKER_MAPPED_INFOSETS
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "cfr.h"
+
+using namespace std;
+
+// flat file of purified infosets that is read in place (mmap) instead of
+// deserialized, so opening it takes no time whatever its size and bot
+// processes on one machine share its pages through the page cache:
+//  header: MAPPED_INFOSETS_MAGIC, then the number of infosets n (ULL)
+//  keys: n ULLs in increasing order
+//  actions: n chars, the pure action of the key at the same position
+// lookups are binary searches over the keys
+const char MAPPED_INFOSETS_MAGIC[8] = {'R', 'P', 'I', 'N', 'F', 'M', 'P', '1'};
+
+struct MappedInfosetsHeader {
+    char magic[8];
+    ULL num_infosets;
+};
+
+inline void save_infosets_to_file_mapped(string filename, const InfosetDictPure &infosets) {
+    vector<pair<ULL, char>> sorted;
+    sorted.reserve(infosets.size());
+    for (auto &kv : infosets) {
+        sorted.push_back(make_pair(kv.first, kv.second.action));
+    }
+    sort(sorted.begin(), sorted.end());
+
+    vector<ULL> keys(sorted.size());
+    vector<char> actions(sorted.size());
+    for (ULL i = 0; i < sorted.size(); i++) {
+        keys[i] = sorted[i].first;
+        actions[i] = sorted[i].second;
+    }
+
+    MappedInfosetsHeader header;
+    memcpy(header.magic, MAPPED_INFOSETS_MAGIC, sizeof(header.magic));
+    header.num_infosets = sorted.size();
+
+    ofstream outfile(filename, ios::binary);
+    outfile.write((const char*) &header, sizeof(header));
+    outfile.write((const char*) keys.data(), keys.size() * sizeof(ULL));
+    outfile.write(actions.data(), actions.size());
+}
+
+// read-only view of a mapped infosets file, answering fetch_infoset like an
+// InfosetDictPure. Empty (every lookup missing) until open succeeds
+struct MappedInfosets {
+    const ULL *keys = nullptr;
+    const char *actions = nullptr;
+    ULL num_infosets = 0;
+
+    void *mapping = nullptr;
+    size_t mapping_size = 0;
+
+    MappedInfosets() {}
+    explicit MappedInfosets(string filename) { open(filename); }
+    ~MappedInfosets() { close(); }
+
+    // the mapping is owned, so views aren't copied
+    MappedInfosets(const MappedInfosets&) = delete;
+    MappedInfosets& operator=(const MappedInfosets&) = delete;
+
+    // false (leaving the view empty) if the file is missing or not in the
+    // format
+    bool open(string filename) {
+        close();
+
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            cout << "WARNING: no mapped infosets at " << filename << endl;
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(MappedInfosetsHeader)) {
+            cout << "WARNING: " << filename << " is too short for mapped infosets" << endl;
+            ::close(fd);
+            return false;
+        }
+        void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd); // the mapping keeps the file open
+        if (data == MAP_FAILED) {
+            cout << "WARNING: could not map " << filename << endl;
+            return false;
+        }
+
+        const MappedInfosetsHeader *header = (const MappedInfosetsHeader*) data;
+        ULL n = header->num_infosets;
+        if (memcmp(header->magic, MAPPED_INFOSETS_MAGIC, sizeof(header->magic)) != 0
+                || st.st_size != sizeof(MappedInfosetsHeader) + n * (sizeof(ULL) + 1)) {
+            cout << "WARNING: " << filename << " isn't a mapped infosets file" << endl;
+            munmap(data, st.st_size);
+            return false;
+        }
+
+        mapping = data;
+        mapping_size = st.st_size;
+        num_infosets = n;
+        keys = (const ULL*) ((const char*) data + sizeof(MappedInfosetsHeader));
+        actions = (const char*) (keys + n);
+        return true;
+    }
+
+    void close() {
+        if (mapping != nullptr) {
+            munmap(mapping, mapping_size);
+        }
+        mapping = nullptr;
+        mapping_size = 0;
+        keys = nullptr;
+        actions = nullptr;
+        num_infosets = 0;
+    }
+
+    ULL size() const { return num_infosets; }
+
+    // false if the key isn't stored
+    bool find(ULL key, int &action) const {
+        const ULL *it = lower_bound(keys, keys + num_infosets, key);
+        if (it == keys + num_infosets || *it != key) {
+            return false;
+        }
+        action = actions[it - keys];
+        return true;
+    }
+
+    bool contains(ULL key) const {
+        int action;
+        return find(key, action);
+    }
+};
+
+// same default as the InfosetDictPure version for keys not in the file
+inline CFRInfosetPure fetch_infoset(const MappedInfosets &infosets,
+                                    ULL key, int num_actions) {
+    int action;
+    if (!infosets.find(key, action)) {
+        action = key_is_facing_bet(key) ? 1 : 0;
+    }
+    return CFRInfosetPure(action);
+}
+
+#endif
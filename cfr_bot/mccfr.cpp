@@ -58,10 +58,10 @@ pair<double, double> mccfr(array<int, BOARD_SIZE> &board,
     // our (traverser's) action
     if (history.ind == 0) {
 
-        vector<double> strategy = infoset.get_regret_matching_strategy();
-        assert(strategy.size() == available_actions.size());
+        ActionValues strategy;
+        infoset.get_regret_matching_strategy(strategy.data());
 
-        vector<double> utils;
+        ActionValues utils;
         pair<double, double> tot_val = {0, 0};
         for (int i = 0; i < available_actions.size(); i++) {
             BoardActionHistory new_history = history;
@@ -70,11 +70,11 @@ pair<double, double> mccfr(array<int, BOARD_SIZE> &board,
                 board, new_history, card_info_state1, card_info_state2, infosets);
 
             tot_val = tot_val + strategy[i]*sub_val;
-            utils.push_back(sub_val.first);
+            utils[i] = sub_val.first;
         }
 
         // utils -> regrets
-        for (int i = 0; i < utils.size(); i++) {
+        for (int i = 0; i < available_actions.size(); i++) {
             utils[i] -= tot_val.first;
         }
 
@@ -87,7 +87,7 @@ pair<double, double> mccfr(array<int, BOARD_SIZE> &board,
             }
             cout << endl;
         }
-        infoset.record(utils, strategy);
+        infoset.record(utils.data(), strategy.data());
         return tot_val;
     }
     // villain's action
@@ -0,0 +1,68 @@
+#include <chrono>
+#include "cfr.h"
+#include "binary.h"
+#include "checkpoint.h"
+
+using namespace std;
+using namespace std::chrono;
+
+bool is_binary_path(const string &path) {
+    return path.size() >= 4 && path.compare(path.size() - 4, 4, ".bin") == 0;
+}
+
+// merges infoset files trained separately (e.g. by separate runs or
+// machines) into one, weighting each infoset by its visits (see
+// merge_infoset). Text files and checkpoints (.ckpt) hold regrets and
+// strategy, binary (.bin) files only the strategy, so the inputs and the
+// output must all be binary or none (a text output from text or checkpoint
+// inputs)
+// usage: merge_infosets <output> <input> <input> ...
+int main(int argc, char *argv[]) {
+    if (argc < 4) {
+        cout << "usage: merge_infosets <output> <input> <input> ..." << endl;
+        return 1;
+    }
+
+    string save_path = argv[1];
+    bool binary = is_binary_path(save_path);
+    if (is_checkpoint_path(save_path)) {
+        cout << "WARNING: " << save_path << " is a checkpoint path, merged tables are saved as text or binary" << endl;
+        return 1;
+    }
+    for (int i = 2; i < argc; i++) {
+        if (is_binary_path(argv[i]) != binary) {
+            cout << "WARNING: " << argv[i] << " isn't in the output's format, nothing merged" << endl;
+            return 1;
+        }
+    }
+
+    InfosetDict merged;
+    for (int i = 2; i < argc; i++) {
+        auto start = high_resolution_clock::now();
+        InfosetDict infosets;
+        if (binary) {
+            load_infosets_from_file_bin(argv[i], &infosets);
+        }
+        else {
+            load_infosets_from_file_any(argv[i], infosets);
+        }
+        merge_infosets(merged, infosets);
+        auto duration = duration_cast<milliseconds>(high_resolution_clock::now() - start);
+
+        cout << "Merged " << infosets.size() << " from " << argv[i] << " in "
+            << duration.count() << " ms (" << merged.size() << " total)." << endl;
+    }
+
+    auto start = high_resolution_clock::now();
+    if (binary) {
+        save_infosets_to_file_bin(save_path, merged);
+    }
+    else {
+        save_infosets_to_file(save_path, merged);
+    }
+    auto duration = duration_cast<milliseconds>(high_resolution_clock::now() - start);
+
+    cout << "Saved to " << save_path << " in " << duration.count() << " ms." << endl;
+
+    return 0;
+}
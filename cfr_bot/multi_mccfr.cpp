@@ -1,13 +1,23 @@
 #include <boost/atomic.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/thread/thread.hpp>
-#include <boost/lockfree/spsc_queue.hpp>
+#include <boost/thread/shared_mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
 #include <iostream>
 #include <random>
 
 #include <signal.h>
+#include <unistd.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #include <cassert>
+#include <cstdio>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <map>
 
 #include "tqdm.h"
 #include "eval7pp.h"
@@ -16,11 +26,42 @@
 #include "compute_equity.h"
 #include "define.h"
 #include "binary.h"
+#include "batch_queue.h"
+#include "affinity.h"
+#include "checkpoint.h"
+#include "fast_load.h"
 
 using namespace std;
 
 // run settings
-#define N_THREADS 8
+// thread counts and pinning, which can be set on the command line (see main)
+struct ThreadSettings {
+    int num_producers = 8;
+    int num_workers = 4; // traversal threads
+    // pin each thread to a CPU, with a deal queue and a copy of the bucket
+    // data per NUMA node for its producers and workers
+    bool pin = true;
+};
+ThreadSettings thread_settings;
+// sharded training over several processes, on one machine or several
+// sharing exchange_dir (see run_coordinator): each shard trains on its own
+// deals, and after every round_iter iterations writes what it learned in the
+// round to exchange_dir and continues from the coordinator's merge of every
+// shard's round
+struct ShardSettings {
+    int shard = -1; // this process's shard, -1 when not sharded
+    int num_shards = 1;
+    int num_rounds = 100;
+    ULL round_iter = 1000000; // per shard
+    string exchange_dir; // DATA_PATH + "cfr_data/shards/" unless set
+};
+ShardSettings shard_settings;
+#define DEAL_BATCH 256 // deals per batch handed from a producer to a worker
+#define N_QUEUED_BATCHES 64 // producers wait while this many batches are queued
+// 1: regrets in a DenseInfosetTable indexed by (tree node, card info), with
+// no hashing or growing while training. 0: hashed InfosetTable, which only
+// holds visited infosets
+#define DENSE_INFOSETS 1
 
 const bool VERBOSE = false;
 const bool SAVE_BINARY = false;
@@ -29,9 +70,25 @@ const bool SAVE_BINARY = false;
 const unsigned long long N_CFR_INIT = 0;
 const unsigned long long N_CFR_ITER = 2000000000;
 const int N_CFR_CHECKPOINTS = 100000000;
+const int CHECKPOINT_THREADS = 4; // threads writing a checkpoint's shards (see checkpoint.h)
 const int N_EVAL_ITER = 100;
+const double SCALING_SECONDS = 5; // per measurement of "multi_mccfr scaling"
+const int SCALING_DEALS = 4096; // deals made up front for the traversal measurements
+const int EXCHANGE_POLL_MS = 100; // how often shards and coordinator look for each other's files
+const int WORKER_BATCH = 64; // traversals between a worker's checks for growing the table
+const ULL N_INFOSETS_RESERVE = 1 << 22; // InfosetTable only
 // const double EPS_GREEDY_EPSILON = 0.1;
 const double EPS_GREEDY_EPSILON = 0.;
+// how regrets and strategy are accumulated (see CFRUpdateRule; compare the
+// rules on Kuhn poker with "multi_mccfr_kuhn bench")
+const CFRUpdateRule UPDATE_RULE(CFRUpdateRule::VANILLA);
+// regret-based pruning (as in Pluribus): from PRUNE_START_ITER on, all but
+// PRUNE_EXPLORE_PROB of iterations skip the traverser's actions whose total
+// regret (the update rule's cumulative regret, see cumulative_regret) is
+// below PRUNE_REGRET
+const ULL PRUNE_START_ITER = 20000000;
+const double PRUNE_EXPLORE_PROB = 0.05;
+const double PRUNE_REGRET = -1000000;
 
 // path strings
 string GAME = "v4";
@@ -42,11 +99,19 @@ string infosets_path;
 string DATA_PATH = "../../data/";
 
 // data structures
-InfosetDict infosets;
+// workers traverse concurrently (Hogwild updates), holding infosets_mutex
+// shared; it is taken exclusively to grow the table or save it
+#if DENSE_INFOSETS
+DenseInfosetTable infosets; // built from the game tree in run_mccfr
+#else
+InfosetTable infosets;
+#endif
+boost::shared_mutex infosets_mutex;
 DataContainer data(
     DATA_PATH + "equity_data/flop_buckets_150.txt",
     DATA_PATH + "equity_data/turn_clusters_150.txt",
-    DATA_PATH + "equity_data/river_clusters_150.txt");
+    DATA_PATH + "equity_data/river_clusters_150.txt",
+    DATA_PATH + "equity_data/turn_buckets_150.bin");
 
 /////////////////////////////////////////////////////////////////////
 /////////////////////// PRODUCER THREAD /////////////////////////////
@@ -63,63 +128,192 @@ struct RoundDeals {
     int winner;
 };
 
-// queue for each producer thread
-volatile bool done = false;
-array<boost::lockfree::spsc_queue<RoundDeals, boost::lockfree::capacity<1024>>, N_THREADS> queues;
+// batches of deals from producers to workers: one queue per NUMA node in use
+// (see place_threads), with the copy of the bucket data its producers use
+// (null: they use data). done stops the producers and workers, at the end of
+// training or on an interrupt (see catch_interrupt)
+boost::atomic<bool> done(false);
+vector<unique_ptr<BatchQueue<RoundDeals>>> deal_queues;
+vector<unique_ptr<DataContainer>> node_data;
 vector<boost::thread> prod_threads; // threads global so we can kill them
 
-// producer that:
-// 1) deals out cards (2 for each player, 5 for the board)
-// 2) computes board+hand (x4 for pf/f/t/r) infostates (x2 for players)
-// 3) computes winner if it gets to showdown
-void producer(int id) {
-    // set up producer
-    random_device rd;
-    mt19937 gen(rd());
-    assert(id < N_THREADS);
-    auto& my_queue = queues[id];
-
-    // do computations
-    while (!done) {
-        RoundDeals my_round_deal{.prod_id = id};
+// CPU each thread is pinned to (-1 if not pinned) and its deal queue
+struct ThreadPlacement {
+    vector<int> producer_cpus, producer_queues;
+    vector<int> worker_cpus, worker_queues;
+    vector<vector<int>> queue_cpus; // CPUs of each queue's node
+};
 
-        // deal out board and cards
-        array<int, BOARD_SIZE> board;
-        array<array<int, HAND_SIZE>, NUM_STREETS> c1;
-        array<array<int, HAND_SIZE>, NUM_STREETS> c2;
-        deal_game_swaps(board, c1, c2, SWAP_ODDS);
+// allowed CPUs, NUMA node by node
+vector<int> get_cpu_order() {
+    vector<int> cpus = get_allowed_cpus();
+    vector<int> cpu_nodes = get_cpu_nodes(cpus.back());
+    stable_sort(cpus.begin(), cpus.end(), [&cpu_nodes](int a, int b) {
+        return cpu_nodes[a] < cpu_nodes[b];
+    });
+    return cpus;
+}
 
-        // generate bitmasks for player hands and board
-        ULL board_mask = indices_to_mask(board);
+// one thread per CPU in get_cpu_order (wrapping around if there are more
+// threads), with workers spread evenly among the producers so that each
+// node's workers are fed by producers on the same node through its queue. A
+// queue left without producers or without workers hands its threads to one
+// that has both
+ThreadPlacement place_threads() {
+    ThreadPlacement placement;
+    int num_producers = thread_settings.num_producers;
+    int num_workers = thread_settings.num_workers;
+    int num_threads = num_producers + num_workers;
+    // shards on one machine take the CPUs after the previous shard's
+    int first_cpu = max(shard_settings.shard, 0) * num_threads;
+    vector<int> cpus = get_cpu_order();
+    vector<int> cpu_nodes = get_cpu_nodes(*max_element(cpus.begin(), cpus.end()));
+
+    map<int, int> node_queues;
+    for (int t = 0; t < num_threads; t++) {
+        int cpu = cpus[(first_cpu + t) % cpus.size()];
+        int queue = 0;
+        if (thread_settings.pin) {
+            int node = cpu_nodes[cpu];
+            if (node_queues.count(node) == 0) {
+                node_queues[node] = placement.queue_cpus.size();
+                placement.queue_cpus.push_back(vector<int>());
+            }
+            queue = node_queues[node];
+            vector<int> &queue_cpus = placement.queue_cpus[queue];
+            if (find(queue_cpus.begin(), queue_cpus.end(), cpu) == queue_cpus.end()) {
+                queue_cpus.push_back(cpu);
+            }
+        }
+        else {
+            cpu = -1;
+        }
 
-        // calculate card infostates
-        // also pre-compute (board, hand) evaluations
-        // hand_strengths[player_num]
-        array<int, 2> hand_strengths;
-        for (int p = 0; p < 2; p++) {
-            array<array<int, HAND_SIZE>, NUM_STREETS> c = (p == 0) ? c1 : c2;
+        bool is_worker = (t + 1) * num_workers / num_threads > t * num_workers / num_threads;
+        (is_worker ? placement.worker_cpus : placement.producer_cpus).push_back(cpu);
+        (is_worker ? placement.worker_queues : placement.producer_queues).push_back(queue);
+    }
+    if (placement.queue_cpus.empty()) {
+        placement.queue_cpus.push_back(vector<int>());
+    }
 
-            my_round_deal.card_info_states[p] = get_cards_info_state(
-                    c, board, data, N_EVAL_ITER);
+    int num_queues = placement.queue_cpus.size();
+    vector<int> queue_producers(num_queues, 0), queue_workers(num_queues, 0);
+    for (int queue : placement.producer_queues) queue_producers[queue]++;
+    for (int queue : placement.worker_queues) queue_workers[queue]++;
+    int fallback = 0;
+    while (fallback < num_queues && (queue_producers[fallback] == 0 || queue_workers[fallback] == 0)) {
+        fallback++;
+    }
+    if (fallback == num_queues) {
+        fallback = 0;
+    }
+    for (int &queue : placement.producer_queues) {
+        if (queue_workers[queue] == 0) queue = fallback;
+    }
+    for (int &queue : placement.worker_queues) {
+        if (queue_producers[queue] == 0) queue = fallback;
+    }
 
-            // just use river cards for showdown
-            ULL c_mask = indices_to_mask(c[NUM_STREETS-1]);
-            assert((board_mask & c_mask) == 0);
-            hand_strengths[p] = evaluate(c_mask | board_mask, 7);
-        }
+    return placement;
+}
 
-        // compute winner if it gets to showdown
-        if (hand_strengths[0] == hand_strengths[1]) { // tie
-            my_round_deal.winner = -1;
-        }
-        else {
-            my_round_deal.winner = hand_strengths[0] < hand_strengths[1];
+// the deal queues and bucket data copies, each allocated while running on
+// its node's CPUs so that the memory is placed on the node (first touch)
+void make_deal_queues(const ThreadPlacement &placement) {
+    vector<int> allowed_cpus = get_allowed_cpus();
+    for (int queue = 0; queue < placement.queue_cpus.size(); queue++) {
+        if (thread_settings.pin) {
+            pin_thread(placement.queue_cpus[queue]);
         }
+        deal_queues.push_back(unique_ptr<BatchQueue<RoundDeals>>(
+            new BatchQueue<RoundDeals>(N_QUEUED_BATCHES)));
+        node_data.push_back(unique_ptr<DataContainer>(
+            thread_settings.pin ? new DataContainer(data) : nullptr));
+    }
+    if (thread_settings.pin) {
+        pin_thread(allowed_cpus);
+    }
+}
+
+// all deal queues' waits together
+BatchQueueStats get_deal_queue_stats() {
+    BatchQueueStats total;
+    for (auto &queue : deal_queues) {
+        BatchQueueStats stats = queue->get_stats();
+        total.batches += stats.batches;
+        total.items += stats.items;
+        total.push_waits += stats.push_waits;
+        total.pop_waits += stats.pop_waits;
+        total.push_wait_seconds += stats.push_wait_seconds;
+        total.pop_wait_seconds += stats.pop_wait_seconds;
+    }
+    return total;
+}
+
+// one round:
+// 1) deals out cards (2 for each player, 5 for the board)
+// 2) computes board+hand (x4 for pf/f/t/r) infostates (x2 for players)
+// 3) computes winner if it gets to showdown
+RoundDeals make_round_deal(int id, const DataContainer &data, BucketStats &bucket_stats) {
+    RoundDeals my_round_deal{.prod_id = id};
+
+    // deal out board and cards
+    array<int, BOARD_SIZE> board;
+    array<array<int, HAND_SIZE>, NUM_STREETS> c1;
+    array<array<int, HAND_SIZE>, NUM_STREETS> c2;
+    deal_game_swaps(board, c1, c2, SWAP_ODDS);
+
+    // generate bitmasks for player hands and board
+    ULL board_mask = indices_to_mask(board);
+
+    // calculate card infostates
+    // also pre-compute (board, hand) evaluations
+    // hand_strengths[player_num]
+    array<int, 2> hand_strengths;
+    for (int p = 0; p < 2; p++) {
+        array<array<int, HAND_SIZE>, NUM_STREETS> c = (p == 0) ? c1 : c2;
+
+        my_round_deal.card_info_states[p] = get_cards_info_state(
+                c, board, data, N_EVAL_ITER, &bucket_stats);
+
+        // just use river cards for showdown
+        ULL c_mask = indices_to_mask(c[NUM_STREETS-1]);
+        assert((board_mask & c_mask) == 0);
+        hand_strengths[p] = evaluate(c_mask | board_mask, 7);
+    }
+
+    // compute winner if it gets to showdown
+    if (hand_strengths[0] == hand_strengths[1]) { // tie
+        my_round_deal.winner = -1;
+    }
+    else {
+        my_round_deal.winner = hand_strengths[0] < hand_strengths[1];
+    }
 
-	my_queue.push(my_round_deal); // don't care if queue is backed up
+    return my_round_deal;
+}
+
+// producer filling batches of deals for the workers on its queue
+void producer(int id, int cpu, int queue) {
+    if (cpu >= 0) {
+        pin_thread(vector<int>(1, cpu));
     }
+    const DataContainer &local_data = node_data[queue] ? *node_data[queue] : data;
+    vector<RoundDeals> batch;
+    batch.reserve(DEAL_BATCH);
+    BucketStats bucket_stats; // work skipped by adaptive turn bucketing
 
-    cout << "Producer " << id << " shutting down" << endl;
+    while (!done) {
+        batch.push_back(make_round_deal(id, local_data, bucket_stats));
+        if (batch.size() == DEAL_BATCH) {
+            deal_queues[queue]->push(batch); // waits while the workers are behind
+        }
+    }
+    // wakes workers waiting for deals after an interrupt
+    deal_queues[queue]->close();
+
+    cout << "Producer " << id << " shutting down " << bucket_stats << endl;
 }
 
 /////////////////////////////////////////////////////////////////////
@@ -130,13 +324,21 @@ void producer(int id) {
 ////////// CFR LOGIC ////////////////
 /////////////////////////////////////
 
+struct MultiStats {
+    ULL actions_explored = 0; // traverser actions recursed into
+    ULL actions_pruned = 0; // traverser actions skipped by pruning
+};
+
 pair<double, double> mccfr(int winner,
-                            GameTreeNode &node,
+                            const FlatGameTree &tree,
+                            const FlatGameNode &node,
                             array<int, NUM_STREETS> &card_info_state1,
-                            array<int, NUM_STREETS> &card_info_state2) {
+                            array<int, NUM_STREETS> &card_info_state2,
+                            bool prune,
+                            MultiStats &stats) {
 
     // reached leaf node
-    if (node.children.size() == 0) {
+    if (node.num_children == 0) {
         assert(node.finished);
         if (VERBOSE) {
             cout << "DEBUG: terminal game tree node " << node << endl;
@@ -164,38 +366,54 @@ pair<double, double> mccfr(int winner,
 
 
     auto& card_info_state = (node.ind == 0) ? card_info_state1 : card_info_state2;
+#if DENSE_INFOSETS
+    CFRInfosetRef infoset = infosets.at(node, card_info_state[node.street]);
+#else
     ULL key = info_to_key(node.history_key, card_info_state[node.street]);
 
-    CFRInfoset& infoset = fetch_infoset(infosets, key, node.children.size());
+    CFRInfosetRef infoset = infosets.fetch_concurrent(key, node.num_children);
+#endif
 
-    assert(infoset.cumu_regrets.size() == node.children.size());
+    assert(infoset.num_actions == node.num_children);
 
     // our (traverser's) action
     if (node.ind == 0) {
 
-        vector<double> strategy = infoset.get_regret_matching_strategy();
-        assert(strategy.size() == node.children.size());
+        ActionValues strategy;
+        infoset.get_regret_matching_strategy(strategy.data());
+
+        // when pruning, skip actions with far negative regret. They have no
+        // probability in strategy, so tot_val is the same without them
+        bool explored[MAX_ACTIONS];
 
-        vector<double> utils(node.children.size());
+        ActionValues utils;
         pair<double, double> tot_val = {0, 0};
-        for (int i = 0; i < node.children.size(); i++) {
-            auto sub_val = mccfr(winner, node.children[i],
-                                card_info_state1, card_info_state2);
+        for (int i = 0; i < node.num_children; i++) {
+            explored[i] = !prune || strategy[i] > 0
+                || infoset.cumulative_regret(i, UPDATE_RULE) >= PRUNE_REGRET;
+            if (!explored[i]) {
+                stats.actions_pruned++;
+                continue;
+            }
+            stats.actions_explored++;
+
+            auto sub_val = mccfr(winner, tree, tree.child(node, i),
+                                card_info_state1, card_info_state2, prune, stats);
 
             tot_val = tot_val + strategy[i]*sub_val;
             utils[i] = sub_val.first;
         }
 
-        // utils -> regrets
-        for (int i = 0; i < utils.size(); i++) {
-            utils[i] -= tot_val.first;
+        // utils -> regrets (0 leaves a pruned action's total regret as is)
+        for (int i = 0; i < node.num_children; i++) {
+            utils[i] = explored[i] ? utils[i] - tot_val.first : 0;
         }
 
         if (VERBOSE) {
             cout << "node: " << node << endl;
-            cout << "num acts: " << node.children.size() << endl;
+            cout << "num acts: " << (int) node.num_children << endl;
         }
-        infoset.record(utils, strategy);
+        infoset.record(utils.data(), strategy.data(), UPDATE_RULE);
         return tot_val;
     }
     // villain's action
@@ -207,22 +425,24 @@ pair<double, double> mccfr(int winner,
         if (VERBOSE) {
             cout << "Sampling child #" << action << endl;
         }
-        return mccfr(winner, node.children[action],
-                        card_info_state1, card_info_state2);
+        return mccfr(winner, tree, tree.child(node, action),
+                        card_info_state1, card_info_state2, prune, stats);
 
     }
 }
 
 // performs allocate stage before recursing into one-board tree
 // 0 = button (SB), 1 = non-button (BB) for traverser (traverser in first index)
-pair<double, double> mccfr_top(RoundDeals round_deal, int ind, GameTreeNode &root) {
+pair<double, double> mccfr_top(RoundDeals round_deal, int ind, const FlatGameTree &tree,
+                               bool prune, MultiStats &stats) {
 
     // traverse game tree
     if (VERBOSE) cout << "== BEGIN MCCFR ==" << endl;
     auto vals = mccfr(
-        round_deal.winner, root,
+        round_deal.winner, tree, tree.root(),
         round_deal.card_info_states[0],
-        round_deal.card_info_states[1]
+        round_deal.card_info_states[1],
+        prune, stats
     );
     if (VERBOSE) cout << "== END MCCFR ==" << endl;
 
@@ -233,122 +453,676 @@ pair<double, double> mccfr_top(RoundDeals round_deal, int ind, GameTreeNode &roo
 ////////// RUN LOGIC ////////////////
 /////////////////////////////////////
 
-struct MultiStats {
-    array<ULL, N_THREADS> queue_misses = {};
-    array<ULL, N_THREADS> queue_hits = {};
+// next round deal from the worker's current batch into round_deal, taking a
+// new batch from the producers (waiting if none is ready) when it runs out.
+// False once the queue is closed and empty, when the worker should stop
+bool consume_round_deal(BatchQueue<RoundDeals> &queue, vector<RoundDeals> &batch,
+                        int &next_deal, RoundDeals &round_deal) {
+    if (next_deal == batch.size()) {
+        next_deal = 0;
+        if (!queue.pop(batch)) {
+            batch.clear();
+            return false;
+        }
+    }
+    round_deal = batch[next_deal++];
+    return true;
+}
+
+// stops training on program interrupt. Saving isn't safe in a signal
+// handler, so this only sets done: run_mccfr saves the progress once the
+// workers stop. A second interrupt kills the program
+void catch_interrupt(int signum) {
+    const char message[] = "Keyboard interrupt, saving progress...\n";
+    ssize_t written = write(STDOUT_FILENO, message, sizeof(message) - 1);
+    (void) written;
+    done = true;
+    signal(signum, SIG_DFL);
+}
+
+// checkpoints are binary (see checkpoint.h) and, with DENSE_INFOSETS, written
+// in the background from a copy of the table taken while the workers wait,
+// so training only stalls for the copy. The hashed table can't be copied
+// while in use and is written in place
+struct CheckpointStats {
+    int checkpoints = 0;
+    double stall_seconds = 0; // workers held up by checkpoints
+    double write_seconds = 0; // writing them
 };
+CheckpointStats checkpoint_stats;
+boost::thread checkpoint_thread;
+#if DENSE_INFOSETS
+DenseInfosetTable checkpoint_snapshot; // the table as of the checkpoint being written
+#endif
+
+// waits for the checkpoint being written, if any
+void finish_checkpoint() {
+    if (checkpoint_thread.joinable()) {
+        checkpoint_thread.join();
+    }
+}
 
-// check all thread queues for finished round deal
-// and take one
-RoundDeals consume_round_deal(int& thread_id, MultiStats& stats) {
-  RoundDeals round_deal;
-  int miss_count = 0;
-  thread_id += 1;
-  thread_id %= N_THREADS;
-  while (!queues[thread_id].pop(round_deal)) {
-    thread_id += 1;
-    thread_id %= N_THREADS;
-    stats.queue_misses[thread_id] += 1;
-    miss_count += 1;
-    if (miss_count % N_THREADS == 0) { // sleep after a full cycle of misses
-	boost::this_thread::sleep(boost::posix_time::microseconds(100));
-    }
-  }
-  stats.queue_hits[thread_id] += 1;
-  return round_deal;
+// called with infosets_mutex held exclusively
+void save_checkpoint(ULL iter) {
+    auto start = boost::posix_time::microsec_clock::local_time();
+    cout << "Reached iter " << iter << ", checkpointing..." << endl;
+    cout << "Deal queues " << get_deal_queue_stats() << endl;
+
+    string infosets_path_partial = DATA_PATH + "cfr_data/" + GAME + "_infosets_" + TAG + "_ckpt" + to_string(iter);
+    string infosets_path = infosets_path_partial + ".ckpt";
+
+    // full dataset for resuming training, and partial dataset for the player
+    auto write = [infosets_path, infosets_path_partial](decltype(infosets) &table) {
+        auto write_start = boost::posix_time::microsec_clock::local_time();
+        save_infosets_to_file_ckpt(infosets_path, table, CHECKPOINT_THREADS);
+        if (SAVE_BINARY)
+            save_infosets_to_file_bin(infosets_path_partial + ".bin", table);
+        checkpoint_stats.write_seconds += (boost::posix_time::microsec_clock::local_time()
+            - write_start).total_milliseconds() / 1000.;
+    };
+
+    // the previous snapshot is in use until its checkpoint is written
+    finish_checkpoint();
+#if DENSE_INFOSETS
+    checkpoint_snapshot = infosets;
+    checkpoint_thread = boost::thread([write]() { write(checkpoint_snapshot); });
+#else
+    write(infosets);
+#endif
+
+    double stall_seconds = (boost::posix_time::microsec_clock::local_time() - start)
+        .total_milliseconds() / 1000.;
+    checkpoint_stats.checkpoints++;
+    checkpoint_stats.stall_seconds += stall_seconds;
+    cout << "Checkpoint held up training for " << stall_seconds << " s" << endl;
 }
 
-// save infoset progress on program interrupt
-void catch_interrupt(int signum) {
-    cout << "Keyboard interrupt, saving progress..." << endl;
+boost::atomic<ULL> next_iter(N_CFR_INIT);
+ULL end_iter = N_CFR_ITER; // rounds times round_iter when sharded
+// no iteration from iter_limit on is handed out: a shard's limit is the end
+// of its current round, moved on once the round is exchanged (workers wait
+// for that on round_changed), otherwise end_iter
+boost::atomic<ULL> iter_limit(N_CFR_ITER);
+boost::mutex round_mutex;
+boost::condition_variable round_changed;
+
+// the next iteration into i, or false if there is none before iter_limit
+bool take_iter(ULL &i) {
+    ULL next = next_iter.load();
+    do {
+        if (next >= iter_limit.load()) {
+            return false;
+        }
+    } while (!next_iter.compare_exchange_weak(next, next + 1));
+    i = next;
+    return true;
+}
 
-    done = true;
-    save_infosets_to_file(infosets_path, infosets);
-    if (SAVE_BINARY) 
-        save_infosets_to_file_bin(infosets_path_partial + ".bin", infosets);
-    exit(signum);
+/////////////////////////////////////////////////////////////////////
+////////////////////////// SHARD EXCHANGE ///////////////////////////
+/////////////////////////////////////////////////////////////////////
+
+// the merged table every shard starts round from
+string round_path(int round) {
+    return shard_settings.exchange_dir + "round" + to_string(round) + ".txt";
 }
 
-void run_mccfr() {
-    int thread_id = 0;
-    MultiStats multi_stats;
+// what shard learned in round (see get_infoset_deltas)
+string shard_path(int round, int shard) {
+    return shard_settings.exchange_dir + "round" + to_string(round)
+        + "_shard" + to_string(shard) + ".txt";
+}
 
-    // if infoset already exists, load in progress
-    infosets_path_partial = DATA_PATH + "cfr_data/" + GAME + "_infosets_" + TAG;
-    infosets_path = infosets_path_partial + ".txt";
-    ifstream infosets_file(infosets_path);
-    
-    cout << "Loading " << infosets_path << endl;
-    if (infosets_file.good()) {
-        load_infosets_from_file(infosets_path, infosets);
+// writes infosets to path at full precision (deltas are differences of
+// averages, which the default 6 digits would lose), under a temporary name
+// first so that path only appears complete
+template<class T>
+void publish_infosets(string path, T &infosets) {
+    string tmp_path = path + ".tmp";
+    {
+        ofstream outfile(tmp_path);
+        outfile << setprecision(numeric_limits<double>::max_digits10) << infosets;
     }
-    cout << "Initial infosets count " << infosets.size() << endl;
+    if (rename(tmp_path.c_str(), path.c_str()) != 0) {
+        cout << "WARNING: could not publish " << path << endl;
+    }
+}
 
-    // save infoset on ctrl-C
-    signal(SIGINT, catch_interrupt);
+void wait_for_file(string path) {
+    while (!ifstream(path).good()) {
+        boost::this_thread::sleep(boost::posix_time::milliseconds(EXCHANGE_POLL_MS));
+    }
+}
+
+// the merged table this shard's current round started from
+InfosetDict shard_base;
+
+// starts the shard's round from the coordinator's merged table
+void load_shard_round(int round) {
+    wait_for_file(round_path(round));
+    infosets.clear();
+    load_infosets_from_file_fast(round_path(round), infosets);
+    shard_base.clear();
+    load_infosets_from_file_fast(round_path(round), shard_base);
+}
 
+// hands in the shard's finished round (0-based) and, unless it was the
+// last, waits for the merge to train the next round on, then lets the
+// workers take the next round's iterations. Called with every iteration of
+// the round done and none of the next round's started (see iter_limit)
+void exchange_shard_round(int round) {
+    assert(next_iter == N_CFR_INIT + (round + 1) * shard_settings.round_iter);
+    InfosetDict trained = infoset_table_to_dict(infosets);
+    InfosetDict deltas = get_infoset_deltas(trained, shard_base);
+    publish_infosets(shard_path(round, shard_settings.shard), deltas);
+    cout << "Shard " << shard_settings.shard << " handed in round " << round
+        << " after " << next_iter - N_CFR_INIT << " iterations ("
+        << deltas.size() << " infosets visited)" << endl;
+
+    if (round + 1 < shard_settings.num_rounds) {
+        load_shard_round(round + 1);
+    }
+    {
+        boost::lock_guard<boost::mutex> lock(round_mutex);
+        iter_limit = min(end_iter, N_CFR_INIT + (round + 2) * shard_settings.round_iter);
+    }
+    round_changed.notify_all();
+}
+
+struct WorkerResult {
+    pair<double, double> train_val = {0, 0};
+    MultiStats stats;
+};
+
+// MCCFR loop of one worker: takes iterations from next_iter until
+// end_iter, in batches between which the table can grow, be saved or be
+// exchanged with the other shards. A shard's round ends exactly after
+// round_iter iterations: workers that run out wait for the exchange
+void worker(int id, int cpu, int queue, array<FlatGameTree, 2> &trees, WorkerResult &result) {
+    if (cpu >= 0) {
+        pin_thread(vector<int>(1, cpu));
+    }
+    vector<RoundDeals> batch;
+    int next_deal = 0;
+    tqdm pbar;
+    bool finished = false;
+
+    while (!finished) {
+        ULL checkpoint = 0;
+        int finished_round = -1;
+        bool round_ended = false;
+        {
+            boost::shared_lock<boost::shared_mutex> lock(infosets_mutex);
+            for (int b = 0; b < WORKER_BATCH; b++) {
+                if (done) { // interrupted
+                    finished = true;
+                    break;
+                }
+                ULL i;
+                if (!take_iter(i)) {
+                    finished = next_iter >= end_iter;
+                    round_ended = !finished;
+                    break;
+                }
+                if (id == 0 && shard_settings.shard <= 0) {
+                    pbar.progress(i - N_CFR_INIT, end_iter - N_CFR_INIT);
+                }
+
+                int ind = i%2; // alternate position
+                RoundDeals round_deal;
+                if (!consume_round_deal(*deal_queues[queue], batch, next_deal, round_deal)) {
+                    finished = true;
+                    break;
+                }
+
+                bool prune = i >= PRUNE_START_ITER && random_unit() >= PRUNE_EXPLORE_PROB;
+                auto val = mccfr_top(round_deal, ind, trees[ind], prune, result.stats);
+                result.train_val = result.train_val + (1./(end_iter - N_CFR_INIT)) * val;
+
+                // shards leave checkpoints to the coordinator
+                if (shard_settings.shard >= 0) {
+                    if ((i+1 - N_CFR_INIT) % shard_settings.round_iter == 0) {
+                        finished_round = (i+1 - N_CFR_INIT) / shard_settings.round_iter - 1;
+                    }
+                }
+                else if ((i+1) % N_CFR_CHECKPOINTS == 0) {
+                    checkpoint = i+1;
+                }
+            }
+        }
+
+        // other workers wait at the end of their batch
+#if DENSE_INFOSETS
+        if (checkpoint != 0 || finished_round >= 0) {
+            boost::unique_lock<boost::shared_mutex> lock(infosets_mutex);
+            if (checkpoint != 0) {
+                save_checkpoint(checkpoint);
+            }
+            if (finished_round >= 0) {
+                exchange_shard_round(finished_round);
+            }
+        }
+#else
+        if (infosets.needs_grow() || checkpoint != 0 || finished_round >= 0) {
+            boost::unique_lock<boost::shared_mutex> lock(infosets_mutex);
+            if (infosets.needs_grow()) {
+                infosets.grow();
+            }
+            if (checkpoint != 0) {
+                save_checkpoint(checkpoint);
+            }
+            if (finished_round >= 0) {
+                exchange_shard_round(finished_round);
+            }
+        }
+#endif
+
+        // the round's last iterations are still running or being exchanged
+        if (round_ended) {
+            boost::unique_lock<boost::mutex> lock(round_mutex);
+            round_changed.wait(lock, []() { return next_iter < iter_limit || next_iter >= end_iter; });
+        }
+    }
+}
+
+// builds the game trees and sizes the infoset table for them
+void init_infosets(array<FlatGameTree, 2> &trees) {
     // traverse and cache game tree (one for each button position)
     // also need to cache trees for different antes since it changes pot size
     // and affects bet sizings => different trees
-    array<GameTreeNode, 2> roots;
     for (int btn = 0; btn < 2; btn++) {
         BoardActionHistory history(btn, 0, 0);
-        roots[btn] = build_game_tree(history);
+        trees[btn] = FlatGameTree(history);
     }
 
-    pair<double, double> train_val = {0, 0};
-
-    // MCCFR loop
-    tqdm pbar;
-    for (unsigned long long i = N_CFR_INIT; i < N_CFR_ITER; ++i) {
-        pbar.progress(i - N_CFR_INIT, N_CFR_ITER - N_CFR_INIT);
+#if DENSE_INFOSETS
+    // both button positions' trees share infoset keys, so one table serves both
+    infosets = DenseInfosetTable(trees[0], get_num_card_infos(data));
+    assert(infosets.covers(trees[1]));
+    cout << "Dense infoset table with " << infosets.num_entries() << " infosets, "
+        << infosets.memory_bytes() / 1000000 << " MB" << endl;
+#else
+    infosets.reserve(N_INFOSETS_RESERVE);
+#endif
+}
 
-        int ind = i%2; // alternate position
-        RoundDeals round_deal = consume_round_deal(thread_id, multi_stats);
+void run_mccfr(const ThreadPlacement &placement) {
+    array<FlatGameTree, 2> trees;
+    init_infosets(trees);
 
-        auto val = mccfr_top(round_deal, ind, roots[ind]);
-        train_val = train_val + (1./N_CFR_ITER) * val;
+    // a shard starts from the coordinator's table, which saves the result
+    bool sharded = shard_settings.shard >= 0;
+    if (sharded) {
+        cout << "Shard " << shard_settings.shard << " of " << shard_settings.num_shards
+            << " waiting for " << round_path(0) << endl;
+        load_shard_round(0);
+    }
+    // if infoset already exists, load in progress (from the interrupted
+    // run's checkpoint if there is one)
+    else {
+        string interrupted_path = infosets_path_partial + ".ckpt";
+        if (ifstream(interrupted_path).good()) {
+            cout << "Loading " << interrupted_path << endl;
+            load_infosets_from_file_ckpt(interrupted_path, infosets);
+        }
+        else {
+            cout << "Loading " << infosets_path << endl;
+            if (ifstream(infosets_path).good()) {
+                load_infosets_from_file_fast(infosets_path, infosets);
+            }
+        }
 
-        if ((i+1) % N_CFR_CHECKPOINTS == 0) {
-            cout << "Reached iter " << i+1 << ", checkpointing..." << endl;
+        // save infoset on ctrl-C
+        signal(SIGINT, catch_interrupt);
+    }
+    cout << "Initial infosets count " << infosets.size() << endl;
 
-            string infosets_path_partial = DATA_PATH + "cfr_data/" + GAME + "_infosets_" + TAG + "_ckpt" + to_string(i+1);
-            string infosets_path = infosets_path_partial + ".txt";
+    // MCCFR loop
+    iter_limit = sharded ? min(end_iter, N_CFR_INIT + shard_settings.round_iter) : end_iter;
+    auto start = boost::posix_time::microsec_clock::local_time();
+    int num_workers = thread_settings.num_workers;
+    vector<WorkerResult> results(num_workers);
+    vector<boost::thread> worker_threads;
+    for (int w = 0; w < num_workers; w++) {
+        int cpu = placement.worker_cpus[w], queue = placement.worker_queues[w];
+        worker_threads.push_back(boost::thread([w, cpu, queue, &trees, &results](){
+            worker(w, cpu, queue, trees, results[w]);
+        }));
+    }
+    for (int w = 0; w < num_workers; w++) {
+        worker_threads[w].join();
+    }
+    bool interrupted = done;
+    ULL iters_run = min(next_iter.load(), end_iter) - N_CFR_INIT;
+    auto elapsed = boost::posix_time::microsec_clock::local_time() - start;
 
-            // full dataset for resuming training
-            save_infosets_to_file(infosets_path, infosets);
-            // partial dataset for the player
-            if (SAVE_BINARY)
-                save_infosets_to_file_bin(infosets_path_partial + ".bin", infosets);
-        }
+    pair<double, double> train_val = {0, 0};
+    MultiStats multi_stats;
+    for (int w = 0; w < num_workers; w++) {
+        train_val = train_val + results[w].train_val;
+        multi_stats.actions_explored += results[w].stats.actions_explored;
+        multi_stats.actions_pruned += results[w].stats.actions_pruned;
+    }
+    // waits on pop are workers starved of deals, waits on push producers
+    // ahead of the workers
+    BatchQueueStats queue_stats = get_deal_queue_stats();
+    cout << "Deal queues " << queue_stats << endl;
+    cout << "Workers waited for deals " << 100. * queue_stats.pop_wait_seconds
+        / (num_workers * (elapsed.total_milliseconds() / 1000. + 1e-9)) << "% of the time" << endl;
+    cout << "Pruned " << 100. * multi_stats.actions_pruned
+        / (multi_stats.actions_explored + multi_stats.actions_pruned + 1e-9)
+        << "% of traverser actions" << endl;
+    cout << "Iterations per second with " << num_workers << " workers = "
+        << iters_run / (elapsed.total_milliseconds() / 1000. + 1e-9) << endl;
+    finish_checkpoint();
+    if (checkpoint_stats.checkpoints > 0) {
+        cout << checkpoint_stats.checkpoints << " checkpoints held up training for "
+            << checkpoint_stats.stall_seconds << " s, writing them took "
+            << checkpoint_stats.write_seconds << " s ("
+            << checkpoint_stats.write_seconds - checkpoint_stats.stall_seconds
+            << " s of stall saved by writing in the background)" << endl;
     }
-    cout << "DEBUG: misses = " << multi_stats.queue_misses << endl;
-    cout << "DEBUG: hits = " << multi_stats.queue_hits << endl;
 
     // print infoset state
     cout << "Average button value during train = " << train_val << endl;
     cout << "Final infosets count " << infosets.size() << endl;
-
+    cout << "Infoset table memory = " << infosets.memory_bytes() / 1000000 << " MB ("
+        << (double) infosets.memory_bytes() / infosets.size() << " bytes per infoset)" << endl;
+
+    // save progress on interrupt, as a binary checkpoint that the next run
+    // resumes from
+    if (interrupted) {
+        cout << "Interrupted after " << iters_run << " iterations, saving to "
+            << infosets_path_partial << ".ckpt" << endl;
+        save_infosets_to_file_ckpt(infosets_path_partial + ".ckpt", infosets, CHECKPOINT_THREADS);
+        if (SAVE_BINARY)
+            save_infosets_to_file_bin(infosets_path_partial + ".bin", infosets);
+    }
     // save updated infoset
-    save_infosets_to_file(infosets_path, infosets);
-    if (SAVE_BINARY)
-        save_infosets_to_file_bin(infosets_path_partial + ".bin", infosets);
+    else if (!sharded) {
+        save_infosets_to_file(infosets_path, infosets);
+        if (SAVE_BINARY)
+            save_infosets_to_file_bin(infosets_path_partial + ".bin", infosets);
+        // an interrupted run's checkpoint is superseded
+        remove((infosets_path_partial + ".ckpt").c_str());
+    }
 
-    // tell producers to end
+    // tell producers to end (waking any waiting on a full queue)
     done = true;
+    for (auto &queue : deal_queues) {
+        queue->close();
+    }
 }
 
-int main() {
+// runs f(thread index, stop flag) on num_threads threads pinned to cpus in
+// turn for SCALING_SECONDS, returning the total count they return per second
+template<class F>
+double measure_rate(int num_threads, const vector<int> &cpus, F f) {
+    boost::atomic<bool> stop(false);
+    vector<ULL> counts(num_threads, 0);
+    vector<boost::thread> threads;
+    auto start = boost::posix_time::microsec_clock::local_time();
+    for (int t = 0; t < num_threads; t++) {
+        int cpu = cpus[t % cpus.size()];
+        threads.push_back(boost::thread([t, cpu, &f, &stop, &counts](){
+            pin_thread(vector<int>(1, cpu));
+            counts[t] = f(t, stop);
+        }));
+    }
+    boost::this_thread::sleep(boost::posix_time::milliseconds((int) (1000 * SCALING_SECONDS)));
+    stop = true;
+    ULL total = 0;
+    for (int t = 0; t < num_threads; t++) {
+        threads[t].join();
+        total += counts[t];
+    }
+    auto elapsed = boost::posix_time::microsec_clock::local_time() - start;
+    return total / (elapsed.total_milliseconds() / 1000. + 1e-9);
+}
+
+// deals per second of n producers, and traversals per second of n workers
+// (on deals made up front, so without producers), for n = 1, 2, 4, ... up to
+// max_threads, with threads pinned to CPUs node by node
+void run_scaling_report(int max_threads) {
+    array<FlatGameTree, 2> trees;
+    init_infosets(trees);
+    vector<int> cpus = get_cpu_order();
+
+    vector<RoundDeals> deals;
+    BucketStats bucket_stats;
+    for (int i = 0; i < SCALING_DEALS; i++) {
+        deals.push_back(make_round_deal(0, data, bucket_stats));
+    }
+
+    cout << "threads\tdeals/s\tper thread\ttraversals/s\tper thread" << endl;
+    for (int n = 1; n <= max_threads; n = (2*n > max_threads && n < max_threads) ? max_threads : 2*n) {
+        double deal_rate = measure_rate(n, cpus, [](int t, boost::atomic<bool> &stop) {
+            BucketStats stats;
+            ULL count = 0;
+            while (!stop) {
+                make_round_deal(t, data, stats);
+                count++;
+            }
+            return count;
+        });
+        double traversal_rate = measure_rate(n, cpus, [&deals, &trees](int t, boost::atomic<bool> &stop) {
+            MultiStats stats;
+            ULL count = 0;
+            while (!stop) {
+                int ind = count % 2;
+                mccfr_top(deals[(count + t * 997) % deals.size()], ind, trees[ind], false, stats);
+                count++;
+            }
+            return count;
+        });
+        cout << n << "\t" << deal_rate << "\t" << deal_rate / n << "\t"
+            << traversal_rate << "\t" << traversal_rate / n << endl;
+    }
+}
+
+// producers and workers training infosets (see run_mccfr)
+void run_threads() {
+    assert(thread_settings.num_producers > 0 && thread_settings.num_workers > 0);
+    ThreadPlacement placement = place_threads();
+    make_deal_queues(placement);
+    cout << thread_settings.num_producers << " producers, " << thread_settings.num_workers
+        << " workers, " << deal_queues.size() << " deal queue(s)"
+        << (thread_settings.pin ? ", pinned" : "") << endl;
+
     // set up producers
-    for (int i = 0; i < N_THREADS; ++i) {
-        prod_threads.push_back(boost::thread([i](){producer(i);}));
+    for (int i = 0; i < thread_settings.num_producers; ++i) {
+        int cpu = placement.producer_cpus[i], queue = placement.producer_queues[i];
+        prod_threads.push_back(boost::thread([i, cpu, queue](){producer(i, cpu, queue);}));
     }
 
-    run_mccfr();
+    run_mccfr(placement);
 
-    for (int i = 0; i < N_THREADS; ++i) {
+    for (int i = 0; i < thread_settings.num_producers; ++i) {
 	    prod_threads[i].join();
     }
+}
+
+/////////////////////////////////////////////////////////////////////
+//////////////////////////// COORDINATOR ////////////////////////////
+/////////////////////////////////////////////////////////////////////
+
+// merges the shards' rounds: publishes the starting table as round 0, calls
+// start_shards (shards may also be started by hand, on this machine or
+// others), then for every round merges each shard's deltas into the table
+// (weighted by visits, see merge_infoset) and publishes the result for the
+// next round. benchmark: start from an empty table and don't save it.
+// Returns iterations per second over the rounds after the first (which
+// includes the shards' start up)
+double run_coordinator(const function<void()> &start_shards, bool benchmark) {
+    ShardSettings &settings = shard_settings;
+    InfosetDict merged;
+    if (!benchmark && ifstream(infosets_path).good()) {
+        cout << "Loading " << infosets_path << endl;
+        load_infosets_from_file_fast(infosets_path, merged);
+    }
+
+    mkdir(settings.exchange_dir.c_str(), 0755);
+    // leftovers of an earlier run would be taken for this one's
+    for (int round = 0; round <= settings.num_rounds; round++) {
+        remove(round_path(round).c_str());
+        for (int shard = 0; shard < settings.num_shards; shard++) {
+            remove(shard_path(round, shard).c_str());
+        }
+    }
+    publish_infosets(round_path(0), merged);
+    start_shards();
+
+    auto start = boost::posix_time::microsec_clock::local_time();
+    double merge_seconds = 0;
+    for (int round = 0; round < settings.num_rounds; round++) {
+        for (int shard = 0; shard < settings.num_shards; shard++) {
+            wait_for_file(shard_path(round, shard));
+            auto merge_start = boost::posix_time::microsec_clock::local_time();
+            InfosetDict deltas;
+            load_infosets_from_file_fast(shard_path(round, shard), deltas);
+            merge_infosets(merged, deltas);
+            remove(shard_path(round, shard).c_str());
+            merge_seconds += (boost::posix_time::microsec_clock::local_time() - merge_start)
+                .total_milliseconds() / 1000.;
+        }
+
+        // every shard has loaded the round's table by now
+        remove(round_path(round).c_str());
+        if (round + 1 < settings.num_rounds) {
+            auto merge_start = boost::posix_time::microsec_clock::local_time();
+            publish_infosets(round_path(round + 1), merged);
+            merge_seconds += (boost::posix_time::microsec_clock::local_time() - merge_start)
+                .total_milliseconds() / 1000.;
+        }
+        if (round == 0 && settings.num_rounds > 1) {
+            start = boost::posix_time::microsec_clock::local_time();
+            merge_seconds = 0;
+        }
+        cout << "Merged round " << round + 1 << "/" << settings.num_rounds << ", "
+            << merged.size() << " infosets" << endl;
+    }
+    auto elapsed = boost::posix_time::microsec_clock::local_time() - start;
+
+    int timed_rounds = max(settings.num_rounds - 1, 1);
+    double seconds = elapsed.total_milliseconds() / 1000. + 1e-9;
+    double iter_per_second = timed_rounds * settings.num_shards * settings.round_iter / seconds;
+    cout << "Iterations per second with " << settings.num_shards << " shards = "
+        << iter_per_second << " (" << 100. * merge_seconds / seconds
+        << "% of the time merging)" << endl;
+
+    if (!benchmark) {
+        save_infosets_to_file(infosets_path, merged);
+        if (SAVE_BINARY)
+            save_infosets_to_file_bin(infosets_path_partial + ".bin", merged);
+    }
+    return iter_per_second;
+}
+
+// runs num_shards shards as child processes of a coordinator
+double run_local_shards(int num_shards, bool benchmark) {
+    shard_settings.num_shards = num_shards;
+    vector<pid_t> children;
+    double iter_per_second = run_coordinator([num_shards, &children]() {
+        cout.flush();
+        for (int shard = 0; shard < num_shards; shard++) {
+            pid_t pid = fork();
+            if (pid == 0) {
+                shard_settings.shard = shard;
+                end_iter = N_CFR_INIT + shard_settings.num_rounds * shard_settings.round_iter;
+                run_threads();
+                exit(0);
+            }
+            children.push_back(pid);
+        }
+    }, benchmark);
+
+    for (pid_t pid : children) {
+        waitpid(pid, nullptr, 0);
+    }
+    return iter_per_second;
+}
+
+// iterations per second of sharded training on this machine with 1, 2, 4
+// and 8 shards, merges included
+void run_shard_scaling_report() {
+    vector<pair<int, double>> rates;
+    for (int num_shards = 1; num_shards <= 8; num_shards *= 2) {
+        rates.push_back(make_pair(num_shards, run_local_shards(num_shards, true)));
+    }
+
+    cout << "shards\titerations/s\tper shard\tspeedup" << endl;
+    for (auto &rate : rates) {
+        cout << rate.first << "\t" << rate.second << "\t" << rate.second / rate.first
+            << "\t" << rate.second / rates[0].second << endl;
+    }
+}
+
+// usage: multi_mccfr [producers workers [nopin]]
+//        multi_mccfr scaling [max threads]
+//    sharded (threads per shard from "producers workers", default 1 1):
+//        multi_mccfr coordinator <shards> <rounds> <round iterations> [dir]
+//        multi_mccfr shard <shard> <shards> <rounds> <round iterations> [dir [producers workers]]
+//        multi_mccfr local <shards> <rounds> <round iterations> [producers workers]
+//        multi_mccfr shard_scaling <rounds> <round iterations> [producers workers]
+int main(int argc, char *argv[]) {
+    infosets_path_partial = DATA_PATH + "cfr_data/" + GAME + "_infosets_" + TAG;
+    infosets_path = infosets_path_partial + ".txt";
+    shard_settings.exchange_dir = DATA_PATH + "cfr_data/shards/";
+
+    string mode = (argc > 1) ? argv[1] : "";
+    if (mode == "scaling") {
+        run_scaling_report((argc > 2) ? atoi(argv[2]) : get_allowed_cpus().size());
+        return 0;
+    }
+
+    if (mode == "coordinator" || mode == "shard" || mode == "local" || mode == "shard_scaling") {
+        vector<string> args(argv + 2, argv + argc);
+        if (mode == "shard") {
+            assert(!args.empty());
+            shard_settings.shard = stoi(args[0]);
+            args.erase(args.begin());
+        }
+        if (mode != "shard_scaling") {
+            assert(!args.empty());
+            shard_settings.num_shards = stoi(args[0]);
+            args.erase(args.begin());
+        }
+        assert(args.size() >= 2);
+        shard_settings.num_rounds = stoi(args[0]);
+        shard_settings.round_iter = stoull(args[1]);
+        args.erase(args.begin(), args.begin() + 2);
+        if ((mode == "coordinator" || mode == "shard") && !args.empty()) {
+            shard_settings.exchange_dir = args[0] + "/";
+            args.erase(args.begin());
+        }
+        thread_settings.num_producers = (args.size() >= 2) ? stoi(args[0]) : 1;
+        thread_settings.num_workers = (args.size() >= 2) ? stoi(args[1]) : 1;
+        assert(shard_settings.shard < shard_settings.num_shards && shard_settings.num_rounds > 0);
+
+        if (mode == "coordinator") {
+            run_coordinator([](){}, false);
+        }
+        else if (mode == "shard") {
+            end_iter = N_CFR_INIT + shard_settings.num_rounds * shard_settings.round_iter;
+            run_threads();
+        }
+        else if (mode == "local") {
+            run_local_shards(shard_settings.num_shards, false);
+        }
+        else {
+            run_shard_scaling_report();
+        }
+        return 0;
+    }
+
+    if (argc > 2) {
+        thread_settings.num_producers = atoi(argv[1]);
+        thread_settings.num_workers = atoi(argv[2]);
+    }
+    if (argc > 3) {
+        thread_settings.pin = string(argv[3]) != "nopin";
+    }
+    run_threads();
 
     cout << "Main thread done." << endl;
     return 0;
@@ -9,6 +9,7 @@
 #include <signal.h>
 #include <stdlib.h>
 #include <cassert>
+#include <chrono>
 
 #include "tqdm.h"
 #include "eval7pp.h"
@@ -30,6 +31,13 @@ const int N_EVAL_ITER = 100;
 // const double EPS_GREEDY_EPSILON = 0.1;
 const double EPS_GREEDY_EPSILON = 0;
 
+// convergence benchmark ("multi_mccfr_kuhn bench"): every update rule is
+// trained from scratch with each seed, measuring exploitability as it goes
+const int BENCH_ITER = 1000000;
+const int BENCH_EVAL_EVERY = 1000;
+const int BENCH_SEEDS = 5;
+const vector<double> BENCH_TARGETS = {0.01, 0.005, 0.002};
+
 // path strings
 string GAME = "cpp_kuhn_poker";
 string TAG = "kuhn";
@@ -38,7 +46,8 @@ string infosets_path;
 string DATA_PATH = "./";
 
 // data structures
-InfosetDict infosets;
+InfosetTable infosets;
+CFRUpdateRule update_rule;
 
 int unvisited;
 
@@ -136,17 +145,17 @@ pair<double, double> mccfr(
 
     ULL key = kuhn_info_to_key(card_info_states[node.ind], node.history_key);
 
-    CFRInfoset& infoset = fetch_infoset(infosets, key, node.children.size());
+    CFRInfosetRef infoset = fetch_infoset(infosets, key, node.children.size());
 
-    assert(infoset.cumu_regrets.size() == node.children.size());
+    assert(infoset.num_actions == node.children.size());
 
     // our (traverser's) action
     if (node.ind == 0) {
 
-        vector<double> strategy = infoset.get_regret_matching_strategy();
-        assert(strategy.size() == node.children.size());
+        ActionValues strategy;
+        infoset.get_regret_matching_strategy(strategy.data());
 
-        vector<double> utils(node.children.size());
+        ActionValues utils;
         pair<double, double> tot_val = {0, 0};
         for (int i = 0; i < node.children.size(); i++) {
             
@@ -157,14 +166,14 @@ pair<double, double> mccfr(
         }
 
         // utils -> regrets
-        for (int i = 0; i < utils.size(); i++) {
+        for (int i = 0; i < node.children.size(); i++) {
             utils[i] -= tot_val.first;
         }
 
         if (VERBOSE) {
             cout << "num acts: " << node.children.size() << endl;
         }
-        infoset.record(utils, strategy);
+        infoset.record(utils.data(), strategy.data(), update_rule);
 
         return tot_val;
     }
@@ -222,33 +231,8 @@ RoundDeals consume_round_deal(int& thread_id, MultiStats& stats) {
   return round_deal;
 }
 
-// save infoset progress on program interrupt
-void catch_interrupt(int signum) {
-    cout << "Keyboard interrupt, saving progress..." << endl;
-
-    done = true;
-    save_infosets_to_file(infosets_path, infosets);
-    exit(signum);
-}
-
-void run_mccfr() {
-    int thread_id = 0;
-    MultiStats multi_stats;
-
-    // if infoset already exists, load in progress
-    infosets_path = DATA_PATH + GAME + "_infosets_" + TAG + ".txt";
-    ifstream infosets_file(infosets_path);
-    if (infosets_file.good()) {
-        load_infosets_from_file(infosets_path, infosets);
-    }
-    cout << "Initial infosets count " << infosets.size() << endl;
-
-    // save infoset on ctrl-C
-    signal(SIGINT, catch_interrupt);
-
-    cout << "Starting traversal..." << endl;
-
-    // traverse and cache game tree (one for each button position)
+// game tree (one for each button position)
+array<GameTreeNode, 2> build_kuhn_trees() {
     // (history_key, won, ind, button, street, finished, showdown)
     // actions are (1,2)
     array<GameTreeNode, 2> roots;
@@ -279,7 +263,37 @@ void run_mccfr() {
 
         roots[btn] = root;
     }
-    
+    return roots;
+}
+
+// save infoset progress on program interrupt
+void catch_interrupt(int signum) {
+    cout << "Keyboard interrupt, saving progress..." << endl;
+
+    done = true;
+    save_infosets_to_file(infosets_path, infosets);
+    exit(signum);
+}
+
+void run_mccfr() {
+    int thread_id = 0;
+    MultiStats multi_stats;
+
+    // if infoset already exists, load in progress
+    infosets_path = DATA_PATH + GAME + "_infosets_" + TAG + ".txt";
+    ifstream infosets_file(infosets_path);
+    if (infosets_file.good()) {
+        load_infosets_from_file(infosets_path, infosets);
+    }
+    cout << "Initial infosets count " << infosets.size() << endl;
+
+    // save infoset on ctrl-C
+    signal(SIGINT, catch_interrupt);
+
+    cout << "Starting traversal..." << endl;
+
+    array<GameTreeNode, 2> roots = build_kuhn_trees();
+
     pair<double, double> train_val = {0, 0};
 
     // MCCFR loop
@@ -310,7 +324,158 @@ void run_mccfr() {
     done = true;
 }
 
-int main() {
+/////////////////////////////////////
+////////// BENCHMARK ////////////////
+/////////////////////////////////////
+
+// average strategy of the infoset, uniform if it was never visited
+vector<double> avg_strategy_or_uniform(ULL key, int num_actions) {
+    CFRInfosetRef infoset;
+    if (infosets.find(key, infoset)) {
+        return infoset.get_avg_strategy();
+    }
+    return vector<double>(num_actions, 1./num_actions);
+}
+
+// value to player 0 (holding card) of best responding from node to the
+// average strategy, summed over player 1's cards weighted by opp_reach
+double best_response_value(GameTreeNode &node, int card, const array<double, 3> &opp_reach) {
+    if (node.children.size() == 0) {
+        double value = 0;
+        for (int opp = 0; opp < 3; opp++) {
+            int winner_mult = (!node.showdown || card > opp) ? 1 : -1;
+            value += opp_reach[opp] * node.won * winner_mult;
+        }
+        return value;
+    }
+
+    if (node.ind == 0) {
+        double best_value = -1e9;
+        for (int i = 0; i < node.children.size(); i++) {
+            best_value = max(best_value, best_response_value(node.children[i], card, opp_reach));
+        }
+        return best_value;
+    }
+
+    array<vector<double>, 3> strategies;
+    for (int opp = 0; opp < 3; opp++) {
+        if (opp_reach[opp] > 0) {
+            strategies[opp] = avg_strategy_or_uniform(
+                kuhn_info_to_key(opp, node.history_key), node.children.size());
+        }
+    }
+
+    double value = 0;
+    for (int i = 0; i < node.children.size(); i++) {
+        array<double, 3> child_reach = {0, 0, 0};
+        for (int opp = 0; opp < 3; opp++) {
+            if (opp_reach[opp] > 0) {
+                child_reach[opp] = opp_reach[opp] * strategies[opp][i];
+            }
+        }
+        value += best_response_value(node.children[i], card, child_reach);
+    }
+    return value;
+}
+
+// how much a best response wins against the average strategy, averaged over
+// both seats (the game is worth 0 over both seats, so 0 at equilibrium)
+double exploitability(array<GameTreeNode, 2> &roots) {
+    double total = 0;
+    for (int btn = 0; btn < 2; btn++) {
+        for (int card = 0; card < 3; card++) {
+            array<double, 3> opp_reach = {0.5, 0.5, 0.5};
+            opp_reach[card] = 0;
+            total += best_response_value(roots[btn], card, opp_reach) / 3;
+        }
+    }
+    return total / 2;
+}
+
+// train with rule for BENCH_ITER iterations (dealing on this thread, so a
+// seed gives the same run), returning exploitability every BENCH_EVAL_EVERY.
+// Adds the time spent training (not evaluating) to seconds
+vector<double> exploitability_trace(const CFRUpdateRule &rule, uint64_t seed,
+                                    array<GameTreeNode, 2> &roots, double &seconds) {
+    update_rule = rule;
+    infosets.clear();
+    gen.seed(seed);
+
+    vector<double> trace;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_ITER; ++i) {
+        RoundDeals round_deal;
+        int a = random_below(3);
+        int b = random_below(2);
+        round_deal.card_info_states = {a, (b < a) ? b : b + 1};
+
+        mccfr_top(round_deal, roots[i%2]);
+
+        if ((i+1) % BENCH_EVAL_EVERY == 0) {
+            seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            trace.push_back(exploitability(roots));
+            start = chrono::steady_clock::now();
+        }
+    }
+    return trace;
+}
+
+// iterations after which exploitability stays at or below each target
+// (averaged over seeds), final exploitability and training speed per rule
+void run_convergence_benchmark() {
+    array<GameTreeNode, 2> roots = build_kuhn_trees();
+
+    vector<pair<string, CFRUpdateRule>> rules = {
+        {"vanilla", CFRUpdateRule(CFRUpdateRule::VANILLA)},
+        {"linear", CFRUpdateRule(CFRUpdateRule::LINEAR)},
+        {"cfr+", CFRUpdateRule(CFRUpdateRule::CFR_PLUS)},
+        {"dcfr(1.5,0,2)", CFRUpdateRule(CFRUpdateRule::DISCOUNTED, 1.5, 0, 2)},
+    };
+
+    cout << "Kuhn MCCFR, " << BENCH_SEEDS << " seeds, iterations until exploitability stays below:" << endl;
+    for (auto &named_rule : rules) {
+        vector<double> iters_to_target(BENCH_TARGETS.size(), 0);
+        vector<int> reached(BENCH_TARGETS.size(), 0);
+        double final_exploitability = 0;
+        double seconds = 0;
+
+        for (int seed = 0; seed < BENCH_SEEDS; seed++) {
+            vector<double> trace = exploitability_trace(named_rule.second, seed, roots, seconds);
+            final_exploitability += trace.back() / BENCH_SEEDS;
+
+            for (int j = 0; j < BENCH_TARGETS.size(); j++) {
+                int last_above = trace.size() - 1;
+                while (last_above >= 0 && trace[last_above] <= BENCH_TARGETS[j]) {
+                    last_above--;
+                }
+                if (last_above < (int) trace.size() - 1) {
+                    iters_to_target[j] += (double) (last_above + 2) * BENCH_EVAL_EVERY;
+                    reached[j]++;
+                }
+            }
+        }
+
+        cout << named_rule.first << ":";
+        for (int j = 0; j < BENCH_TARGETS.size(); j++) {
+            cout << " " << BENCH_TARGETS[j] << " -> ";
+            if (reached[j] == BENCH_SEEDS) {
+                cout << (ULL) (iters_to_target[j] / BENCH_SEEDS);
+            }
+            else {
+                cout << "not reached (" << reached[j] << "/" << BENCH_SEEDS << " seeds)";
+            }
+        }
+        cout << ", final " << final_exploitability;
+        cout << ", " << (ULL) (BENCH_SEEDS * BENCH_ITER / seconds) << " iter/s" << endl;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "bench") {
+        run_convergence_benchmark();
+        return 0;
+    }
+
     // set up producers
     for (int i = 0; i < N_THREADS; ++i) {
         prod_threads.push_back(boost::thread([i](){producer(i);}));
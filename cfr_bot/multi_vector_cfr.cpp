@@ -0,0 +1,204 @@
+#include <boost/atomic.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/shared_mutex.hpp>
+#include <iostream>
+
+#include <signal.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <cassert>
+
+#include "tqdm.h"
+#include "eval7pp.h"
+
+#include "vector_cfr.h"
+#include "compute_equity.h"
+#include "define.h"
+#include "binary.h"
+
+using namespace std;
+
+// public chance sampling trainer (see vector_cfr.h): each iteration samples a
+// board and traverses the tree once for every bucket of both players, where
+// multi_mccfr samples one hand per player. Iterations cost far more but each
+// trains every infoset along the tree for the board. Saves the same infoset
+// files as multi_mccfr
+
+// run settings
+#define N_WORKERS 4 // traversal threads (each deals its own boards)
+
+const bool SAVE_BINARY = false;
+
+// CFR constants
+const unsigned long long N_CFR_INIT = 0;
+const unsigned long long N_CFR_ITER = 10000000;
+const int N_CFR_CHECKPOINTS = 100000;
+const int WORKER_BATCH = 4; // boards between a worker's checks for checkpoints
+const CFRUpdateRule UPDATE_RULE(CFRUpdateRule::VANILLA);
+
+// path strings
+string GAME = "v4";
+string TAG = "150post_vector";
+
+string infosets_path_partial;
+string infosets_path;
+string DATA_PATH = "../../data/";
+
+// data structures
+// workers traverse concurrently (Hogwild updates), holding infosets_mutex
+// shared; it is taken exclusively to save the table
+DenseInfosetTable infosets; // built from the game tree in run_vector_cfr
+boost::shared_mutex infosets_mutex;
+DataContainer data(
+    DATA_PATH + "equity_data/flop_buckets_150.txt",
+    DATA_PATH + "equity_data/turn_clusters_150.txt",
+    DATA_PATH + "equity_data/river_clusters_150.txt",
+    DATA_PATH + "equity_data/turn_buckets_150.bin");
+
+// stops the workers on an interrupt (see catch_interrupt)
+boost::atomic<bool> done(false);
+
+// stops training on program interrupt. Saving isn't safe in a signal
+// handler, so this only sets done: run_vector_cfr saves the progress once
+// the workers stop. A second interrupt before the save starts kills the
+// program
+void catch_interrupt(int signum) {
+    const char message[] = "Keyboard interrupt, saving progress...\n";
+    ssize_t written = write(STDOUT_FILENO, message, sizeof(message) - 1);
+    (void) written;
+    done = true;
+    signal(signum, SIG_DFL);
+}
+
+void save_checkpoint(ULL iter) {
+    cout << "Reached iter " << iter << ", checkpointing..." << endl;
+
+    string infosets_path_partial = DATA_PATH + "cfr_data/" + GAME + "_infosets_" + TAG + "_ckpt" + to_string(iter);
+    string infosets_path = infosets_path_partial + ".txt";
+
+    save_infosets_to_file(infosets_path, infosets);
+    if (SAVE_BINARY)
+        save_infosets_to_file_bin(infosets_path_partial + ".bin", infosets);
+}
+
+boost::atomic<ULL> next_iter(N_CFR_INIT);
+
+// vector CFR loop of one worker: takes iterations from next_iter until
+// N_CFR_ITER (or an interrupt), in batches between which the table can be
+// saved
+void worker(int id, array<FlatGameTree, 2> &trees, double &train_val) {
+    tqdm pbar;
+    bool finished = false;
+
+    while (!finished) {
+        ULL checkpoint = 0;
+        {
+            boost::shared_lock<boost::shared_mutex> lock(infosets_mutex);
+            for (int b = 0; b < WORKER_BATCH; b++) {
+                if (done) { // interrupted
+                    finished = true;
+                    break;
+                }
+                ULL i = next_iter++;
+                if (i >= N_CFR_ITER) {
+                    finished = true;
+                    break;
+                }
+                if (id == 0) {
+                    pbar.progress(i - N_CFR_INIT, N_CFR_ITER - N_CFR_INIT);
+                }
+
+                Deck deck;
+                array<int, BOARD_SIZE> board;
+                for (int c = 0; c < BOARD_SIZE; c++) {
+                    board[c] = deck.deal();
+                }
+                BoardChance chance = get_board_chance(board, data, SWAP_ODDS);
+
+                int ind = i%2; // alternate position
+                train_val += vector_cfr_top(trees[ind], chance, infosets, UPDATE_RULE) / N_CFR_ITER;
+
+                if ((i+1) % N_CFR_CHECKPOINTS == 0) {
+                    checkpoint = i+1;
+                }
+            }
+        }
+
+        // other workers wait at the end of their batch
+        if (checkpoint != 0) {
+            boost::unique_lock<boost::shared_mutex> lock(infosets_mutex);
+            save_checkpoint(checkpoint);
+        }
+    }
+}
+
+void run_vector_cfr() {
+    infosets_path_partial = DATA_PATH + "cfr_data/" + GAME + "_infosets_" + TAG;
+    infosets_path = infosets_path_partial + ".txt";
+    ifstream infosets_file(infosets_path);
+
+    // one tree for each button position
+    array<FlatGameTree, 2> trees;
+    for (int btn = 0; btn < 2; btn++) {
+        BoardActionHistory history(btn, 0, 0);
+        trees[btn] = FlatGameTree(history);
+    }
+
+    infosets = DenseInfosetTable(trees[0], get_num_card_infos(data));
+    assert(infosets.covers(trees[1]));
+    cout << "Dense infoset table with " << infosets.num_entries() << " infosets, "
+        << infosets.memory_bytes() / 1000000 << " MB" << endl;
+
+    // if infoset already exists, load in progress
+    cout << "Loading " << infosets_path << endl;
+    if (infosets_file.good()) {
+        load_infosets_from_file(infosets_path, infosets);
+    }
+    cout << "Initial infosets count " << infosets.size() << endl;
+
+    // save infoset on ctrl-C
+    signal(SIGINT, catch_interrupt);
+
+    auto start = boost::posix_time::microsec_clock::local_time();
+    array<double, N_WORKERS> train_vals = {};
+    vector<boost::thread> worker_threads;
+    for (int w = 0; w < N_WORKERS; w++) {
+        worker_threads.push_back(boost::thread([w, &trees, &train_vals](){
+            worker(w, trees, train_vals[w]);
+        }));
+    }
+    for (int w = 0; w < N_WORKERS; w++) {
+        worker_threads[w].join();
+    }
+    ULL iters_run = min(next_iter.load(), N_CFR_ITER) - N_CFR_INIT;
+    auto elapsed = boost::posix_time::microsec_clock::local_time() - start;
+
+    double train_val = 0;
+    for (int w = 0; w < N_WORKERS; w++) {
+        train_val += train_vals[w];
+    }
+    cout << "Iterations per second with " << N_WORKERS << " workers = "
+        << iters_run / (elapsed.total_milliseconds() / 1000. + 1e-9) << endl;
+    cout << "Average traverser value during train = " << train_val << endl;
+    cout << "Final infosets count " << infosets.size() << endl;
+
+    // save updated infoset (the next run resumes from it, interrupted or
+    // not). The text file is written in place, so a second interrupt now
+    // would tear it: ignore them until it is saved
+    if (done) {
+        cout << "Interrupted after " << iters_run << " iterations, saving to "
+            << infosets_path << endl;
+    }
+    signal(SIGINT, SIG_IGN);
+    save_infosets_to_file(infosets_path, infosets);
+    if (SAVE_BINARY)
+        save_infosets_to_file_bin(infosets_path_partial + ".bin", infosets);
+}
+
+int main() {
+    run_vector_cfr();
+
+    cout << "Main thread done." << endl;
+    return 0;
+}
@@ -1,13 +1,13 @@
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
 
 #include "cfr.h"
 
 using namespace std;
 
-random_device CFR_RD;
-mt19937 CFR_GEN(CFR_RD());
-uniform_real_distribution<> CFR_RAND(0, 1);
-
 //////////////////////////////////////////
 /////////// pure CFR infoset /////////////
 //////////////////////////////////////////
@@ -88,127 +88,659 @@ CFRInfosetPure purify_infoset(CFRInfoset full_infoset, ULL key,
 CFRInfoset::CFRInfoset() {}
 
 CFRInfoset::CFRInfoset(int num_actions)
-        : cumu_regrets(num_actions, 0), cumu_strategy(num_actions, 0) {}
+        : cumu_regrets(num_actions, 0), cumu_strategy(num_actions, 0) {
+    assert(num_actions <= MAX_ACTIONS);
+}
 
 CFRInfoset::CFRInfoset(vector<double> init_cumu_regrets, vector<double> init_cumu_strategy, int init_t)
         : cumu_regrets(init_cumu_regrets), cumu_strategy(init_cumu_strategy), t(init_t) {}
 
-void CFRInfoset::record(vector<double> regrets, vector<double> strategy) {
+// running averages of regrets and strategy after the (t+1)-th visit, with
+// the visits weighted (and regrets discounted) according to rule
+template<class Storage>
+static void record_average(typename Storage::value_type cumu_regrets[],
+                           typename Storage::value_type cumu_strategy[],
+                           int num_actions, int t,
+                           const double regrets[], const double strategy[],
+                           const CFRUpdateRule &rule) {
     double new_weight = 1 / (double) (t+1);
     double old_weight = (double) t / (double) (t+1);
 
-    // cout.precision(20);
-    // cout << "init cumu_regrets " << cumu_regrets << endl;
-    // cout << "record[t=" << t << "] regrets " << regrets << endl;
-    assert(regrets.size() == strategy.size());
-    assert(regrets.size() == cumu_regrets.size());
-    assert(regrets.size() == cumu_strategy.size());
-    for (int i = 0; i < regrets.size(); i++) {
-        cumu_regrets[i] = regrets[i] * new_weight + cumu_regrets[i] * old_weight;
-        cumu_strategy[i] = strategy[i] * new_weight + cumu_strategy[i] * old_weight;
+    // factors for the old positive regrets, negative regrets and strategy
+    double positive_weight = old_weight;
+    double negative_weight = old_weight;
+    double strategy_weight = old_weight;
+    switch (rule.type) {
+    case CFRUpdateRule::VANILLA:
+        break;
+    case CFRUpdateRule::LINEAR:
+        positive_weight = negative_weight = strategy_weight = old_weight * old_weight;
+        break;
+    case CFRUpdateRule::CFR_PLUS:
+        strategy_weight = old_weight * old_weight;
+        break;
+    case CFRUpdateRule::DISCOUNTED:
+        if (t > 0) {
+            positive_weight *= 1 / (1 + pow((double) t, -rule.alpha));
+            negative_weight *= 1 / (1 + pow((double) t, -rule.beta));
+            strategy_weight = pow(old_weight, rule.gamma + 1);
+        }
+        break;
+    }
+
+    for (int i = 0; i < num_actions; i++) {
+        double old_regret = Storage::load(cumu_regrets[i]);
+        double regret = old_regret * (old_regret > 0 ? positive_weight : negative_weight)
+            + regrets[i] * new_weight;
+        if (rule.type == CFRUpdateRule::CFR_PLUS) {
+            regret = max(regret, 0.0);
+        }
+        cumu_regrets[i] = Storage::store(regret);
+        cumu_strategy[i] = Storage::store(
+            Storage::load(cumu_strategy[i]) * strategy_weight + strategy[i] * new_weight);
     }
-    // cout << "final cumu_regrets " << cumu_regrets << endl;
-    t += 1;
 }
 
-int CFRInfoset::get_action_index_avg() {
-    double norm = accumulate(cumu_strategy.begin(), cumu_strategy.end(), 0.0);
+// a regret record_average left after t visits as the rule's cumulative
+// regret (the sum over visits its CFR variant keeps, in chips): the
+// average is that sum over t, or over t^2 for LINEAR
+static double cumulative_regret_of_average(double regret, int t, const CFRUpdateRule &rule) {
+    if (rule.type == CFRUpdateRule::LINEAR) {
+        return regret * (double) t * (double) t;
+    }
+    return regret * (double) t;
+}
+
+// sample an index with probability proportional to weights[i] (>= 0, summing
+// to norm > 0) with a single uniform draw instead of a discrete_distribution
+static int sample_weighted_index(const double weights[], int num_weights, double norm) {
+    double u = random_unit() * norm;
+    for (int i = 0; i < num_weights; i++) {
+        u -= weights[i];
+        if (u < 0) {
+            return i;
+        }
+    }
+
+    // rounding can leave u just above 0: take the last nonzero weight
+    int last = num_weights-1;
+    while (last > 0 && weights[last] <= 0) last--;
+    return last;
+}
+
+template<class Storage>
+static int action_index_avg(const typename Storage::value_type cumu_strategy[], int num_actions) {
+    ActionValues weights;
+    double norm = 0;
+    for (int i = 0; i < num_actions; i++) {
+        weights[i] = Storage::load(cumu_strategy[i]);
+        norm += weights[i];
+    }
     if (norm > 0.0) {
-        discrete_distribution<> d(cumu_strategy.begin(), cumu_strategy.end());
-        return d(CFR_GEN);
+        return sample_weighted_index(weights.data(), num_actions, norm);
     }
     else {
-        uniform_int_distribution<> d(0, cumu_strategy.size()-1);
-        return d(CFR_GEN);
+        return random_below(num_actions);
     }
 }
 
-vector<double> CFRInfoset::get_avg_strategy() {
-    double norm = accumulate(cumu_strategy.begin(), cumu_strategy.end(), 0.0);
-    vector<double> strategy(cumu_strategy.size(), 1./cumu_strategy.size());
+template<class Storage>
+static vector<double> avg_strategy(const typename Storage::value_type cumu_strategy[], int num_actions) {
+    double norm = 0;
+    for (int i = 0; i < num_actions; i++) {
+        norm += Storage::load(cumu_strategy[i]);
+    }
+    vector<double> strategy(num_actions, 1./num_actions);
     if (norm > 0.0) {
-        for (int i = 0; i < cumu_strategy.size(); ++i) {
-            strategy[i] = cumu_strategy[i] / norm;
+        for (int i = 0; i < num_actions; ++i) {
+            strategy[i] = Storage::load(cumu_strategy[i]) / norm;
         }
     }
     return strategy;
 }
 
+template<class Storage>
+static void regret_matching_strategy(const typename Storage::value_type cumu_regrets[],
+                                     int num_actions, double strategy[]) {
+    double total_pos_regrets = 0;
+    for (int i = 0; i < num_actions; i++) {
+        total_pos_regrets += max(Storage::load(cumu_regrets[i]), 0.0);
+    }
+
+    for (int i = 0; i < num_actions; i++) {
+        if (total_pos_regrets != 0) {
+            strategy[i] = max(Storage::load(cumu_regrets[i]), 0.0) / total_pos_regrets;
+        }
+        else {
+            strategy[i] = 1. / (double) num_actions;
+        }
+    }
+}
+
+// epsilon-greedy: take random action with prob eps, else sample regret matching
+template<class Storage>
+static int action_index(const typename Storage::value_type cumu_regrets[],
+                        int num_actions, double eps) {
+    if (random_unit() < eps) {
+        return random_below(num_actions);
+    }
+
+    ActionValues strategy;
+    regret_matching_strategy<Storage>(cumu_regrets, num_actions, strategy.data());
+    return sample_weighted_index(strategy.data(), num_actions, 1.0);
+}
+
+void CFRInfoset::record(const double regrets[], const double strategy[],
+                        const CFRUpdateRule &rule) {
+    assert(cumu_regrets.size() == cumu_strategy.size());
+    record_average<DoubleStorage>(cumu_regrets.data(), cumu_strategy.data(),
+                   cumu_regrets.size(), t, regrets, strategy, rule);
+    t += 1;
+}
+
+void CFRInfoset::record(const vector<double> &regrets, const vector<double> &strategy,
+                        const CFRUpdateRule &rule) {
+    assert(regrets.size() == strategy.size());
+    assert(regrets.size() == cumu_regrets.size());
+    record(regrets.data(), strategy.data(), rule);
+}
+
+double CFRInfoset::cumulative_regret(int i, const CFRUpdateRule &rule) const {
+    return cumulative_regret_of_average(cumu_regrets[i], t, rule);
+}
+
+int CFRInfoset::get_action_index_avg() {
+    return action_index_avg<DoubleStorage>(cumu_strategy.data(), cumu_strategy.size());
+}
+
+vector<double> CFRInfoset::get_avg_strategy() {
+    return avg_strategy<DoubleStorage>(cumu_strategy.data(), cumu_strategy.size());
+}
+
 int CFRInfoset::get_action_index(double eps) {
-    // epsilon-greedy: take random action with prob eps
-    if (CFR_RAND(CFR_GEN) < eps) {
-        return CFR_GEN() % cumu_regrets.size();
+    return action_index<DoubleStorage>(cumu_regrets.data(), cumu_regrets.size(), eps);
+}
+
+void CFRInfoset::get_regret_matching_strategy(double strategy[]) const {
+    regret_matching_strategy<DoubleStorage>(cumu_regrets.data(), cumu_regrets.size(), strategy);
+}
+
+vector<double> CFRInfoset::get_regret_matching_strategy() const {
+    vector<double> strategy(cumu_regrets.size());
+    get_regret_matching_strategy(strategy.data());
+    return strategy;
+}
+
+//////////////////////////////////////////
+///// flat infoset table for training ////
+//////////////////////////////////////////
+
+template<class Storage>
+void CFRInfosetRefT<Storage>::record(const double regrets[], const double strategy[],
+                                     const CFRUpdateRule &rule) {
+    int visits = t();
+    record_average<Storage>(cumu_regrets(), cumu_strategy(), num_actions, visits,
+                            regrets, strategy, rule);
+    set_t(visits + 1);
+}
+
+template<class Storage>
+void CFRInfosetRefT<Storage>::record(const vector<double> &regrets, const vector<double> &strategy,
+                                     const CFRUpdateRule &rule) {
+    assert(regrets.size() == strategy.size());
+    assert(regrets.size() == num_actions);
+    record(regrets.data(), strategy.data(), rule);
+}
+
+template<class Storage>
+double CFRInfosetRefT<Storage>::cumulative_regret(int i, const CFRUpdateRule &rule) const {
+    return cumulative_regret_of_average(regret(i), t(), rule);
+}
+
+template<class Storage>
+int CFRInfosetRefT<Storage>::get_action_index_avg() {
+    return action_index_avg<Storage>(cumu_strategy(), num_actions);
+}
+
+template<class Storage>
+vector<double> CFRInfosetRefT<Storage>::get_avg_strategy() {
+    return avg_strategy<Storage>(cumu_strategy(), num_actions);
+}
+
+template<class Storage>
+int CFRInfosetRefT<Storage>::get_action_index(double eps) {
+    return action_index<Storage>(cumu_regrets(), num_actions, eps);
+}
+
+template<class Storage>
+void CFRInfosetRefT<Storage>::get_regret_matching_strategy(double strategy[]) const {
+    regret_matching_strategy<Storage>(cumu_regrets(), num_actions, strategy);
+}
+
+template<class Storage>
+vector<double> CFRInfosetRefT<Storage>::get_regret_matching_strategy() const {
+    vector<double> strategy(num_actions);
+    get_regret_matching_strategy(strategy.data());
+    return strategy;
+}
+
+template<class Storage>
+const ULL InfosetTableT<Storage>::EMPTY_KEY;
+
+template<class Storage>
+InfosetTableT<Storage>::InfosetTableT(ULL capacity)
+        : blocks(MAX_BLOCKS), slab_used(0), num_infosets(0), num_blocks(0) {
+    ULL num_slots = 16;
+    while (num_slots < capacity) num_slots *= 2;
+    vector<atomic<ULL>> new_keys(num_slots), new_entries(num_slots);
+    for (ULL i = 0; i < num_slots; i++) {
+        new_keys[i].store(EMPTY_KEY, memory_order_relaxed);
+    }
+    keys.swap(new_keys);
+    entries.swap(new_entries);
+}
+
+template<class Storage>
+InfosetTableT<Storage>::~InfosetTableT() {
+    for (int i = 0; i < MAX_BLOCKS; i++) {
+        delete[] blocks[i].load();
     }
+}
 
-    vector<double> strategy = get_regret_matching_strategy();
-    discrete_distribution<> d(strategy.begin(), strategy.end());
+template<class Storage>
+void InfosetTableT<Storage>::reserve(ULL n) {
+    // keep the load factor under 3/4
+    while (4*n > 3*keys.size()) {
+        grow();
+    }
+}
 
-    return d(CFR_GEN);
+template<class Storage>
+CFRInfosetRefT<Storage> InfosetTableT<Storage>::fetch(ULL key, int num_actions) {
+    if (4*(num_infosets.load()+1) > 3*keys.size()) {
+        grow();
+    }
+    return fetch_concurrent(key, num_actions);
 }
 
-vector<double> CFRInfoset::get_regret_matching_strategy() {
-    double total_pos_regrets = 0;
-    vector<double> cumu_pos_regrets = cumu_regrets;
-            
-    for (int i = 0; i < cumu_regrets.size(); i++) {
-        cumu_pos_regrets[i] = max(cumu_pos_regrets[i], 0.0);
-        total_pos_regrets += cumu_pos_regrets[i];
+template<class Storage>
+CFRInfosetRefT<Storage> InfosetTableT<Storage>::fetch_concurrent(ULL key, int num_actions) {
+    assert(key != EMPTY_KEY);
+
+    ULL slot = probe(key);
+    while (keys[slot].load(memory_order_acquire) != key) { // free when probed
+        assert(16*(num_infosets.load()+1) <= 15*keys.size()); // grow() wasn't called in time
+        ULL expected = EMPTY_KEY;
+        if (keys[slot].compare_exchange_strong(expected, key)) {
+            ULL offset = allocate_entry(num_actions);
+            entries[slot].store(offset << 8 | num_actions, memory_order_release);
+            num_infosets++;
+            break;
+        }
+        // another thread claimed the slot first (maybe with the same key)
+        slot = probe(key);
     }
+    return at(slot);
+}
 
-    vector<double> strategy(cumu_regrets.size(), 1. / (double) cumu_regrets.size());
+template<class Storage>
+bool InfosetTableT<Storage>::find(ULL key, Ref &infoset) const {
+    ULL slot = probe(key);
+    if (keys[slot].load(memory_order_acquire) == EMPTY_KEY) {
+        return false;
+    }
+    infoset = at(slot);
+    return true;
+}
 
-    if (total_pos_regrets != 0) {
-        for (int i = 0; i < cumu_regrets.size(); i++) {
-            strategy[i] = cumu_pos_regrets[i] / total_pos_regrets;
+template<class Storage>
+void InfosetTableT<Storage>::clear() {
+    for (ULL i = 0; i < keys.size(); i++) {
+        keys[i].store(EMPTY_KEY, memory_order_relaxed);
+        entries[i].store(0, memory_order_relaxed);
+    }
+    for (int i = 0; i < MAX_BLOCKS; i++) {
+        delete[] blocks[i].exchange(nullptr);
+    }
+    slab_used = 0;
+    num_infosets = 0;
+    num_blocks = 0;
+}
+
+template<class Storage>
+void InfosetTableT<Storage>::insert(ULL key, int t, const vector<double> &cumu_regrets,
+                                    const vector<double> &cumu_strategy) {
+    if (4*(num_infosets.load()+1) > 3*keys.size()) {
+        grow();
+    }
+    insert_concurrent(key, t, cumu_regrets, cumu_strategy);
+}
+
+template<class Storage>
+void InfosetTableT<Storage>::insert_concurrent(ULL key, int t, const vector<double> &cumu_regrets,
+                                               const vector<double> &cumu_strategy) {
+    assert(cumu_regrets.size() == cumu_strategy.size());
+    Ref infoset = fetch_concurrent(key, cumu_regrets.size());
+    assert(infoset.num_actions == cumu_regrets.size());
+    infoset.set_t(t);
+    for (int i = 0; i < infoset.num_actions; i++) {
+        infoset.cumu_regrets()[i] = Storage::store(cumu_regrets[i]);
+        infoset.cumu_strategy()[i] = Storage::store(cumu_strategy[i]);
+    }
+}
+
+template<class Storage>
+ULL InfosetTableT<Storage>::memory_bytes() const {
+    return keys.size() * (sizeof(ULL) + sizeof(ULL))
+        + (ULL) num_blocks.load() * (sizeof(Value) << BLOCK_BITS);
+}
+
+// zeroed slab space for an entry. Entries don't straddle blocks: one that
+// would is dropped (wasting the block's tail) and the next space taken
+template<class Storage>
+ULL InfosetTableT<Storage>::allocate_entry(int num_actions) {
+    assert(num_actions > 0 && num_actions <= MAX_ACTIONS);
+
+    ULL entry_size = 1 + 2*num_actions;
+    ULL offset = slab_used.fetch_add(entry_size);
+    while ((offset >> BLOCK_BITS) != ((offset + entry_size - 1) >> BLOCK_BITS)) {
+        offset = slab_used.fetch_add(entry_size);
+    }
+
+    ULL block = offset >> BLOCK_BITS;
+    assert(block < MAX_BLOCKS);
+    if (blocks[block].load(memory_order_acquire) == nullptr) {
+        lock_guard<mutex> lock(block_mutex);
+        if (blocks[block].load(memory_order_relaxed) == nullptr) {
+            blocks[block].store(new Value[1ULL << BLOCK_BITS](), memory_order_release);
+            num_blocks++;
         }
     }
+    return offset;
+}
 
-    return strategy;
+template<class Storage>
+void InfosetTableT<Storage>::grow() {
+    // swapped with the current arrays below, after which these hold the old ones
+    vector<atomic<ULL>> old_keys(keys.size()*2), old_entries(keys.size()*2);
+    for (ULL i = 0; i < old_keys.size(); i++) {
+        old_keys[i].store(EMPTY_KEY, memory_order_relaxed);
+    }
+    keys.swap(old_keys);
+    entries.swap(old_entries);
+
+    for (ULL i = 0; i < old_keys.size(); i++) {
+        ULL key = old_keys[i].load(memory_order_relaxed);
+        if (key == EMPTY_KEY) {
+            continue;
+        }
+        ULL slot = probe(key);
+        keys[slot].store(key, memory_order_relaxed);
+        entries[slot].store(old_entries[i].load(memory_order_relaxed), memory_order_relaxed);
+    }
 }
 
-int get_bucket_from_clusters(
-    ULL hand, ULL board, int num_board,
-    const EquityClusters &clusters, int iterations,
-    ULL common_dead, ULL villain_dead) {
+template struct CFRInfosetRefT<DoubleStorage>;
+template struct CFRInfosetRefT<FloatStorage>;
+template struct CFRInfosetRefT<FixedStorage>;
+template struct InfosetTableT<DoubleStorage>;
+template struct InfosetTableT<FloatStorage>;
+template struct InfosetTableT<FixedStorage>;
+
+// all fixed ranges as one combo union for the multi-range equity engine.
+// Built on first use since RANGES is itself dynamically initialized
+static const MultiRange& get_fixed_ranges() {
+    static const MultiRange fixed_ranges = [] {
+        const ULL* ranges[NUM_RANGES];
+        for (int i = 0; i < NUM_RANGES; i++) ranges[i] = RANGES[i];
+        return make_multi_range(ranges, NUM_RANGE, NUM_RANGES);
+    }();
+    return fixed_ranges;
+}
+
+int get_bucket_from_equities(const float equities[], const EquityClusters &clusters) {
 
-    double equity, dist;
+    double dist;
 
     int bucket = -1;
     double smallest_dist = clusters.size();
 
-    vector<double> distance_squared;
-    for (int i = 0; i < clusters.size(); i++) distance_squared.push_back(0);
+    for (int j = 0; j < clusters.size(); j++) {
+        double distance_squared = 0;
+        for (int i = 0; i < NUM_RANGES; i++) {
+            dist = equities[i] - clusters[j][i];
+            distance_squared += dist*dist;
+        }
+
+        if (distance_squared < smallest_dist) {
+            bucket = j;
+            smallest_dist = distance_squared;
+        }
+    }
+    assert(bucket != -1);
+
+    return bucket;
+}
 
+// squared distance from equities to a cluster center
+static double cluster_distance(const float equities[],
+                               const array<double, NUM_RANGES> &center) {
+    double distance_squared = 0;
     for (int i = 0; i < NUM_RANGES; i++) {
-        if (iterations > 0) {
-            equity = hand_vs_range_monte_carlo(hand, RANGES[i], NUM_RANGE[i],
-                                                board, num_board, iterations,
-                                                common_dead, villain_dead);
+        double dist = equities[i] - center[i];
+        distance_squared += dist*dist;
+    }
+    return distance_squared;
+}
+
+// true if no candidate can beat the nearest one by more than tolerance with
+// the equities moved by up to z standard errors. dist^2(e, c_j) -
+// dist^2(e, c_nearest) is linear in e, with gradient 2*(c_nearest - c_j), so
+// its standard error comes straight from the per-range variances
+static bool bucket_is_settled(const float equities[], const float variances[],
+                              const EquityClusters &clusters,
+                              const vector<int> &candidates, int nearest,
+                              double z, double tolerance) {
+    for (int j : candidates) {
+        if (j == nearest) continue;
+
+        double margin = 0, var = 0;
+        for (int i = 0; i < NUM_RANGES; i++) {
+            double to_j = equities[i] - clusters[j][i];
+            double to_nearest = equities[i] - clusters[nearest][i];
+            double gradient = 2*(clusters[nearest][i] - clusters[j][i]);
+            margin += to_j*to_j - to_nearest*to_nearest;
+            var += gradient*gradient*variances[i];
         }
-        else {
-            equity = hand_vs_range_exact(hand, RANGES[i], NUM_RANGE[i],
-                                            board, num_board,
-                                            common_dead, villain_dead);
+
+        margin += tolerance;
+        if (margin <= 0 || margin*margin <= z*z*var) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Monte Carlo bucketing that samples in rounds, narrowing the candidate
+// clusters and the sampled ranges as the equity estimates tighten
+static int get_bucket_adaptive(RangesMonteCarlo &sampler,
+                               const EquityClusters &clusters, int iterations,
+                               double z, double tolerance, BucketStats *stats) {
+
+    vector<int> candidates(clusters.size());
+    for (int j = 0; j < clusters.size(); j++) candidates[j] = j;
+
+    vector<double> distances(clusters.size());
+    float equities[NUM_RANGES], variances[NUM_RANGES];
+    double errors[NUM_RANGES];
+    long long cluster_checks = 0;
+
+    int nearest = -1;
+    sampler.sample(min(iterations, ADAPTIVE_MIN_SAMPLES));
+    while (true) {
+        sampler.equities(equities);
+        sampler.variances(variances);
+        for (int i = 0; i < NUM_RANGES; i++) {
+            errors[i] = z*sqrt(variances[i]);
         }
 
-        for (int j = 0; j < clusters.size(); j++) {
-            dist = equity - clusters[j][i];
-            distance_squared[j] += dist*dist;
+        // with every range within z standard errors, the true equities are
+        // within radius of the estimate, so (triangle inequality) each true
+        // distance is within radius of the estimated one. A candidate more than
+        // twice the radius further than the nearest cannot be nearest
+        double radius_squared = 0;
+        for (int i = 0; i < NUM_RANGES; i++) {
+            radius_squared += errors[i]*errors[i];
+        }
 
-            if (i == NUM_RANGES-1) {
-                if (distance_squared[j] < smallest_dist) {
-                    bucket = j;
-                    smallest_dist = distance_squared[j];
-                }
+        double best_distance = INFINITY;
+        for (int k = 0; k < candidates.size(); k++) {
+            distances[k] = cluster_distance(equities, clusters[candidates[k]]);
+            if (distances[k] < best_distance) {
+                nearest = candidates[k];
+                best_distance = distances[k];
+            }
+        }
+        cluster_checks += candidates.size();
+
+        double reach = sqrt(best_distance) + 2*sqrt(radius_squared);
+        int num_candidates = 0;
+        for (int k = 0; k < candidates.size(); k++) {
+            if (distances[k] <= reach*reach) {
+                candidates[num_candidates] = candidates[k];
+                num_candidates++;
             }
         }
+        candidates.resize(num_candidates);
+
+        if (sampler.iterations >= iterations || candidates.size() == 1 ||
+                bucket_is_settled(equities, variances, clusters, candidates,
+                                  nearest, z, tolerance)) {
+            break;
+        }
+
+        // a range whose estimate can't shift any candidate's margin by more
+        // than its share of the tolerance no longer needs sampling
+        for (int i = 0; i < NUM_RANGES; i++) {
+            if (!sampler.active[i]) continue;
+
+            double low = INFINITY, high = -INFINITY;
+            for (int j : candidates) {
+                low = min(low, clusters[j][i]);
+                high = max(high, clusters[j][i]);
+            }
+            if (2*(high - low)*errors[i] < tolerance / NUM_RANGES) {
+                sampler.active[i] = false;
+            }
+        }
+
+        // each round doubles the samples, so checks stay a small share of the work
+        sampler.sample(min(sampler.iterations, iterations - sampler.iterations));
     }
-    assert(bucket != -1);
 
-    return bucket;
+    if (stats != nullptr) {
+        stats->calls++;
+        stats->runouts += sampler.iterations;
+        stats->max_runouts += iterations;
+        stats->evaluations += sampler.evaluations;
+        stats->max_evaluations += (long long)iterations*(NUM_RANGES + 1);
+        stats->cluster_checks += cluster_checks;
+        stats->max_cluster_checks += clusters.size();
+    }
+
+    assert(nearest != -1);
+    return nearest;
+}
+
+int get_bucket_from_clusters(
+    ULL hand, ULL board, int num_board,
+    const EquityClusters &clusters, int iterations,
+    ULL common_dead, ULL villain_dead, double confidence_z,
+    double tolerance, BucketStats *stats) {
+
+    // equities against every range from a single pass over the runouts
+    float equities[NUM_RANGES];
+    if (iterations == 0) {
+        hand_vs_ranges_exact(hand, get_fixed_ranges(), board, num_board,
+                             equities, common_dead, villain_dead);
+        return get_bucket_from_equities(equities, clusters);
+    }
+
+    RangesMonteCarlo sampler(hand, get_fixed_ranges(), board, num_board,
+                             common_dead, villain_dead);
+    if (confidence_z > 0) {
+        return get_bucket_adaptive(sampler, clusters, iterations,
+                                   confidence_z, tolerance, stats);
+    }
+
+    sampler.sample(iterations);
+    sampler.equities(equities);
+    return get_bucket_from_equities(equities, clusters);
+}
+
+void compute_bucket_table(BucketTable &table, int num_board,
+                          const EquityClusters &clusters, int num_threads) {
+    assert(clusters.size() <= 256); // buckets are stored in one byte
+
+    const HandIndexer &indexer = get_hand_indexer(num_board);
+    const MultiRange &fixed_ranges = get_fixed_ranges();
+    table.assign(indexer.size(), 0);
+
+    // threads take blocks of classes in turn
+    const ULL block_size = 1024;
+    atomic<ULL> next_block(0), num_done(0);
+
+    auto worker = [&]() {
+        float equities[NUM_RANGES];
+        ULL hand, board;
+        while (true) {
+            ULL start = next_block.fetch_add(block_size);
+            if (start >= indexer.size()) {
+                break;
+            }
+
+            ULL end = min(start + block_size, indexer.size());
+            for (ULL i = start; i < end; i++) {
+                indexer.unindex(i, hand, board);
+                hand_vs_ranges_exact(hand, fixed_ranges, board, num_board, equities);
+                table[i] = get_bucket_from_equities(equities, clusters);
+            }
+            num_done += end - start;
+        }
+    };
+
+    vector<thread> threads;
+    for (int i = 0; i < num_threads; i++) {
+        threads.push_back(thread(worker));
+    }
+
+    tqdm pbar;
+    while (num_done < indexer.size()) {
+        pbar.progress(num_done, indexer.size());
+        this_thread::sleep_for(chrono::seconds(1));
+    }
+    pbar.finish();
+
+    for (thread &t : threads) {
+        t.join();
+    }
+}
+
+RiverBoardCache get_river_board_cache(ULL board) {
+    return RiverBoardCache(board, get_fixed_ranges());
+}
+
+int get_bucket_from_clusters(
+    ULL hand, const RiverBoardCache &cache, const EquityClusters &clusters,
+    ULL common_dead, ULL villain_dead) {
+
+    float equities[NUM_RANGES];
+    cache.equities(hand, equities, common_dead | villain_dead);
+
+    return get_bucket_from_equities(equities, clusters);
 }
 
-ULL info_to_key(int player_ind, int street, int card_info, BoardActionHistory &history) {
+ULL info_to_key(int player_ind, int street, int card_info, const BoardActionHistory &history) {
     int action_bits;
     ULL key = 0;
 
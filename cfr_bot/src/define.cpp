@@ -1,3 +1,5 @@
+#include <cassert>
+
 #include "define.h"
 
 const int NUM_RANGE[8] = {460, 30, 48, 60, 240, 280, 276, 244};
@@ -15,3 +17,277 @@ unsigned long long RANGES[8][460] = {
 
 const string suits[] = {"c", "d", "h", "s"};
 const string ranks[] = {"2", "3", "4", "5", "6", "7", "8", "9", "T", "J", "Q", "K", "A"};
+
+//////// suit-isomorphic hand indexing ////////
+
+static const int SUIT_RANKS_MASK = (1 << 13) - 1;
+static const int MAX_SUIT_CODE = 18; // codes are hole*6 + board, hole <= 2, board <= 5
+
+// n choose k, exact in 64 bits for the small k used here (k <= 4 for the
+// multiset ranks over up to 36036 suit descriptions)
+static ULL choose(ULL n, int k) {
+    if (k < 0 || n < (ULL)k) {
+        return 0;
+    }
+    switch (k) {
+        case 0: return 1;
+        case 1: return n;
+        case 2: return n*(n-1) / 2;
+        case 3: return n*(n-1)*(n-2) / 6;
+        case 4: return n*(n-1)*(n-2)*(n-3) / 24;
+    }
+    ULL result = 1;
+    for (int i = 0; i < k; i++) {
+        result = result * (n - i) / (i + 1);
+    }
+    return result;
+}
+
+// choose(n, k) for rank positions (n <= 13, k <= 5)
+static const unsigned short RANK_CHOOSE[14][6] = {
+    {1, 0, 0, 0, 0, 0},
+    {1, 1, 0, 0, 0, 0},
+    {1, 2, 1, 0, 0, 0},
+    {1, 3, 3, 1, 0, 0},
+    {1, 4, 6, 4, 1, 0},
+    {1, 5, 10, 10, 5, 1},
+    {1, 6, 15, 20, 15, 6},
+    {1, 7, 21, 35, 35, 21},
+    {1, 8, 28, 56, 70, 56},
+    {1, 9, 36, 84, 126, 126},
+    {1, 10, 45, 120, 210, 252},
+    {1, 11, 55, 165, 330, 462},
+    {1, 12, 66, 220, 495, 792},
+    {1, 13, 78, 286, 715, 1287},
+};
+
+// colexicographic rank of a set of ranks among sets of the same size
+static ULL rank_set_index(int ranks) {
+    ULL index = 0;
+    for (int j = 1; ranks != 0; j++) {
+        index += RANK_CHOOSE[__builtin_ctz(ranks)][j];
+        ranks &= ranks - 1;
+    }
+    return index;
+}
+
+static int rank_set_unindex(ULL index, int count) {
+    int ranks = 0;
+    for (int j = count; j >= 1; j--) {
+        int r = j - 1;
+        while (choose(r + 1, j) <= index) {
+            r++;
+        }
+        index -= choose(r, j);
+        ranks |= 1 << r;
+    }
+    return ranks;
+}
+
+// board ranks renumbered over the ranks not in the hole back to real ranks
+static int expand_ranks(int compressed, int removed) {
+    int ranks = 0;
+    for (int r = 0, k = 0; r < 13; r++) {
+        if ((removed >> r) & 1) continue;
+        ranks |= ((compressed >> k) & 1) << r;
+        k++;
+    }
+    return ranks;
+}
+
+// number of (hole, board) rank sets one suit can hold with a given code
+static ULL suit_size(int code) {
+    int num_hole = code / 6, num_board = code % 6;
+    return choose(13, num_hole) * choose(13 - num_hole, num_board);
+}
+
+static ULL suit_index(int hole_ranks, int board_ranks) {
+    int num_hole = __builtin_popcount(hole_ranks);
+    int num_board = __builtin_popcount(board_ranks);
+
+    // rank index of the board ranks renumbered over the ranks not in the hole:
+    // each board rank moves down past the hole ranks below it
+    ULL board_index = 0;
+    for (int j = 1; board_ranks != 0; j++) {
+        int r = __builtin_ctz(board_ranks);
+        board_index += RANK_CHOOSE[r - __builtin_popcount(hole_ranks & ((1 << r) - 1))][j];
+        board_ranks &= board_ranks - 1;
+    }
+
+    return rank_set_index(hole_ranks) * RANK_CHOOSE[13 - num_hole][num_board] + board_index;
+}
+
+// number of multisets of m values in [0, n)
+static ULL multiset_size(ULL n, int m) {
+    return choose(n + m - 1, m);
+}
+
+// rank of a multiset given in descending order, via the combinatorial number
+// system on values[m-1-i] + i (strictly increasing)
+static ULL multiset_index(const ULL values[], int m) {
+    ULL index = 0;
+    for (int i = 0; i < m; i++) {
+        index += choose(values[m-1-i] + i, i + 1);
+    }
+    return index;
+}
+
+// inverse of multiset_index for values in [0, n), written in descending order
+static void multiset_unindex(ULL index, ULL n, int m, ULL values[]) {
+    for (int i = m - 1; i >= 0; i--) {
+        // largest y with choose(y, i+1) <= index
+        ULL low = i, high = n - 1 + i;
+        while (low < high) {
+            ULL mid = (low + high + 1) / 2;
+            if (choose(mid, i + 1) <= index) {
+                low = mid;
+            }
+            else {
+                high = mid - 1;
+            }
+        }
+        index -= choose(low, i + 1);
+        values[m-1-i] = low - i;
+    }
+}
+
+// every sorted tuple of suit codes with 2 hole cards and num_board board cards
+static void get_suit_configs(vector<array<int, 4>> &configs, array<int, 4> &codes,
+                             int suit, int max_code, int num_hole, int num_board) {
+    if (suit == 4) {
+        if (num_hole == 0 && num_board == 0) {
+            configs.push_back(codes);
+        }
+        return;
+    }
+    for (int code = max_code; code >= 0; code--) {
+        if (code / 6 > num_hole || code % 6 > num_board) continue;
+        codes[suit] = code;
+        get_suit_configs(configs, codes, suit + 1, code,
+                         num_hole - code / 6, num_board - code % 6);
+    }
+}
+
+static int config_key(const int codes[]) {
+    int key = 0;
+    for (int k = 3; k >= 0; k--) {
+        key = key * MAX_SUIT_CODE + codes[k];
+    }
+    return key;
+}
+
+HandIndexer::HandIndexer(int num_board) :
+        num_board(num_board),
+        config_ids(MAX_SUIT_CODE*MAX_SUIT_CODE*MAX_SUIT_CODE*MAX_SUIT_CODE, -1) {
+
+    array<int, 4> codes;
+    get_suit_configs(config_codes, codes, 0, MAX_SUIT_CODE - 1, 2, num_board);
+
+    num_indices = 0;
+    for (int id = 0; id < config_codes.size(); id++) {
+        const array<int, 4> &config = config_codes[id];
+        config_ids[config_key(config.data())] = id;
+        config_offsets.push_back(num_indices);
+
+        ULL config_size = 1;
+        for (int start = 0, end; start < 4; start = end) {
+            for (end = start; end < 4 && config[end] == config[start]; end++);
+            config_size *= multiset_size(suit_size(config[start]), end - start);
+        }
+        num_indices += config_size;
+    }
+}
+
+ULL HandIndexer::index(ULL hole, ULL board) const {
+    int hole_ranks[4], board_ranks[4], codes[4];
+    ULL suit_indices[4];
+    int order[4];
+
+    for (int s = 0; s < 4; s++) {
+        hole_ranks[s] = (hole >> (13*s)) & SUIT_RANKS_MASK;
+        board_ranks[s] = (board >> (13*s)) & SUIT_RANKS_MASK;
+        codes[s] = __builtin_popcount(hole_ranks[s])*6 + __builtin_popcount(board_ranks[s]);
+        suit_indices[s] = suit_index(hole_ranks[s], board_ranks[s]);
+        order[s] = s;
+    }
+
+    // sort suits by code, then by description (both descending)
+    for (int i = 1; i < 4; i++) {
+        for (int j = i; j > 0; j--) {
+            int a = order[j-1], b = order[j];
+            if (codes[a] > codes[b] ||
+                    (codes[a] == codes[b] && suit_indices[a] >= suit_indices[b])) {
+                break;
+            }
+            swap(order[j-1], order[j]);
+        }
+    }
+
+    int sorted_codes[4];
+    ULL sorted_indices[4];
+    for (int k = 0; k < 4; k++) {
+        sorted_codes[k] = codes[order[k]];
+        sorted_indices[k] = suit_indices[order[k]];
+    }
+
+    int id = config_ids[config_key(sorted_codes)];
+    assert(id != -1);
+
+    // mixed radix over groups of suits sharing a code, first group highest
+    ULL index = 0;
+    for (int start = 0, end; start < 4; start = end) {
+        for (end = start; end < 4 && sorted_codes[end] == sorted_codes[start]; end++);
+        int m = end - start;
+        index = index * multiset_size(suit_size(sorted_codes[start]), m) +
+                multiset_index(sorted_indices + start, m);
+    }
+
+    return config_offsets[id] + index;
+}
+
+void HandIndexer::unindex(ULL index, ULL &hole, ULL &board) const {
+    assert(index < num_indices);
+
+    int id = upper_bound(config_offsets.begin(), config_offsets.end(), index) -
+             config_offsets.begin() - 1;
+    const array<int, 4> &config = config_codes[id];
+    index -= config_offsets[id];
+
+    // peel groups off from the last (lowest) one
+    ULL suit_indices[4];
+    for (int end = 4, start; end > 0; end = start) {
+        for (start = end; start > 0 && config[start-1] == config[end-1]; start--);
+        int m = end - start;
+        ULL n = suit_size(config[start]);
+        ULL group_size = multiset_size(n, m);
+        multiset_unindex(index % group_size, n, m, suit_indices + start);
+        index /= group_size;
+    }
+
+    hole = 0;
+    board = 0;
+    for (int s = 0; s < 4; s++) {
+        int num_hole = config[s] / 6, num_board = config[s] % 6;
+        ULL board_size = choose(13 - num_hole, num_board);
+
+        int hole_ranks = rank_set_unindex(suit_indices[s] / board_size, num_hole);
+        int board_ranks = expand_ranks(
+            rank_set_unindex(suit_indices[s] % board_size, num_board), hole_ranks);
+
+        hole |= (ULL)hole_ranks << (13*s);
+        board |= (ULL)board_ranks << (13*s);
+    }
+}
+
+const HandIndexer& get_hand_indexer(int num_board) {
+    switch (num_board) {
+        case 0: { static const HandIndexer preflop(0); return preflop; }
+        case 3: { static const HandIndexer flop(3); return flop; }
+        case 4: { static const HandIndexer turn(4); return turn; }
+        case 5: { static const HandIndexer river(5); return river; }
+    }
+    cout << "WARNING: no hand indexer for board size " << num_board << endl;
+    assert(false);
+    static const HandIndexer preflop(0);
+    return preflop;
+}
@@ -1,9 +1,5 @@
 #include "game.h"
 
-random_device GAME_RD;
-mt19937 GAME_GEN(GAME_RD());
-uniform_real_distribution<> GAME_RAND(0, 1);
-
 ostream& print_action(ostream& os, int action) {
     if (action == FOLD) {
         return os << "fold";
@@ -219,18 +215,14 @@ void deal_game_swaps(
     array<array<int, HAND_SIZE>, NUM_STREETS> &c1,
     array<array<int, HAND_SIZE>, NUM_STREETS> &c2,
     array<float, NUM_STREETS-1> swap_odds) {
-    ULL dead = 0;
+    // every card dealt this game (board, hands and swaps) is distinct,
+    // so all of them come off one deck
+    Deck deck;
     int ind;
 
     // deal complete board
-    int i = 0;
-    while (i < BOARD_SIZE) {
-        ind = sample_card_dist();
-        if ((dead & CARD_MASKS_TABLE[ind]) == 0) {
-            board[i] = ind;
-            dead |= CARD_MASKS_TABLE[ind];
-            i++;
-        }
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        board[i] = deck.deal();
     }
 
     // deal hands
@@ -238,13 +230,9 @@ void deal_game_swaps(
         // check dealing on each street
         for (int j = 0; j < 2*HAND_SIZE; j++) {
             // if pre-flop or if a swap rolls, deal a new card
-            if (i == 0 || GAME_RAND(GAME_GEN) < swap_odds[i-1]) {
+            if (i == 0 || random_unit() < swap_odds[i-1]) {
 
-                // keep drawing until we get a new card
-                ind = sample_card_dist();
-                while ((CARD_MASKS_TABLE[ind] & dead) != 0) {
-                    ind = sample_card_dist();
-                }
+                ind = deck.deal();
 
                 // first two cards to player 1, last two to player 2
                 if (j < HAND_SIZE) {
@@ -253,8 +241,6 @@ void deal_game_swaps(
                 else {
                     c2[i][j - HAND_SIZE] = ind;
                 }
-
-                dead |= CARD_MASKS_TABLE[ind];
             }
             // else use the same card from previous street
             else {
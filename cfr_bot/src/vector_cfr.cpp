@@ -0,0 +1,137 @@
+#include <algorithm>
+
+#include "vector_cfr.h"
+
+using namespace std;
+
+BoardChance get_board_chance(const array<int, BOARD_SIZE> &board, const DataContainer &data,
+                             const array<float, NUM_STREETS-1> &swap_odds) {
+    assert(!data.turn_buckets.empty());
+
+    BoardChance chance(get_num_card_infos(data));
+    ULL board_mask = indices_to_mask(board);
+    array<int, FLOP_SIZE> flop;
+    copy(board.begin(), board.begin() + FLOP_SIZE, flop.begin());
+    array<int, TURN_SIZE> turn_board;
+    copy(board.begin(), board.begin() + TURN_SIZE, turn_board.begin());
+    ULL turn_mask = indices_to_mask(turn_board);
+    RiverBoardCache river_cache = get_river_board_cache(board_mask);
+
+    // every hand off the board: its bucket on each street and river strength
+    vector<array<int, HAND_SIZE>> hands;
+    vector<array<int, NUM_STREETS>> buckets;
+    vector<int> strengths;
+    array<array<int, 52>, 52> hand_index;
+    for (int c1 = 0; c1 < 52; c1++) {
+        hand_index[c1].fill(-1);
+    }
+    for (int c1 = 0; c1 < 52; c1++) {
+        for (int c2 = c1 + 1; c2 < 52; c2++) {
+            array<int, HAND_SIZE> hand = {c1, c2};
+            ULL hand_mask = indices_to_mask(hand);
+            if ((hand_mask & board_mask) != 0) {
+                continue;
+            }
+            hand_index[c1][c2] = hand_index[c2][c1] = hands.size();
+            hands.push_back(hand);
+
+            array<int, HAND_SIZE> preflop_hand = hand; // sorted in place
+            array<int, NUM_STREETS> hand_buckets;
+            hand_buckets[0] = get_cards_info_state_preflop(preflop_hand);
+            hand_buckets[1] = get_cards_info_state_flop(hand, flop, data);
+            hand_buckets[2] = get_cards_info_state_turn(hand_mask, turn_mask, data);
+            hand_buckets[3] = get_bucket_from_clusters(hand_mask, river_cache, data.river_clusters);
+            buckets.push_back(hand_buckets);
+            strengths.push_back(evaluate(hand_mask | board_mask, 7));
+        }
+    }
+    int num_hands = hands.size();
+
+    array<vector<int>, NUM_STREETS> bucket_sizes;
+    for (int street = 0; street < NUM_STREETS; street++) {
+        bucket_sizes[street].assign(chance.num_buckets[street], 0);
+        for (int h = 0; h < num_hands; h++) {
+            assert(buckets[h][street] < chance.num_buckets[street]);
+            bucket_sizes[street][buckets[h][street]]++;
+        }
+        for (int b = 0; b < chance.num_buckets[street]; b++) {
+            chance.prior[street][b] = (double) bucket_sizes[street][b] / num_hands;
+        }
+    }
+
+    // before each street, each card is swapped with probability p for one of
+    // the cards off the board and the hand. Both cards swapped is taken as a
+    // fresh hand
+    int num_swap_cards = 52 - BOARD_SIZE - HAND_SIZE;
+    for (int street = 0; street < NUM_STREETS-1; street++) {
+        double p = swap_odds[street];
+        for (int h = 0; h < num_hands; h++) {
+            int b = buckets[h][street];
+            double weight = 1. / bucket_sizes[street][b];
+            chance.transition(street, b, buckets[h][street+1]) += weight * (1-p)*(1-p);
+            if (p == 0) {
+                continue;
+            }
+
+            double swap_weight = weight * p*(1-p) / num_swap_cards;
+            for (int kept = 0; kept < HAND_SIZE; kept++) {
+                int kept_card = hands[h][kept], swapped_card = hands[h][1 - kept];
+                for (int card = 0; card < 52; card++) {
+                    int new_hand = hand_index[kept_card][card];
+                    if (card == swapped_card || new_hand == -1) {
+                        continue;
+                    }
+                    chance.transition(street, b, buckets[new_hand][street+1]) += swap_weight;
+                }
+            }
+            for (int next_b = 0; next_b < chance.num_buckets[street+1]; next_b++) {
+                chance.transition(street, b, next_b) += weight * p*p * chance.prior[street+1][next_b];
+            }
+        }
+    }
+
+    // showdown scores by river bucket: each hand against all weaker and
+    // stronger ones, going through the hands from weakest to strongest
+    int river = NUM_STREETS-1;
+    int n = chance.num_buckets[river];
+    vector<int> order(num_hands);
+    for (int h = 0; h < num_hands; h++) {
+        order[h] = h;
+    }
+    sort(order.begin(), order.end(), [&strengths](int h1, int h2) {
+        return strengths[h1] < strengths[h2];
+    });
+
+    vector<double> scores(n * n, 0); // bucket major
+    vector<int> weaker(n, 0), tied(n, 0);
+    for (int start = 0; start < num_hands;) {
+        int end = start;
+        while (end < num_hands && strengths[order[end]] == strengths[order[start]]) {
+            tied[buckets[order[end]][river]]++;
+            end++;
+        }
+        for (int i = start; i < end; i++) {
+            double *row = &scores[buckets[order[i]][river] * n];
+            for (int opp_b = 0; opp_b < n; opp_b++) {
+                // wins - losses = weaker - (size - weaker - tied)
+                row[opp_b] += 2*weaker[opp_b] + tied[opp_b] - bucket_sizes[river][opp_b];
+            }
+        }
+        for (int i = start; i < end; i++) {
+            int b = buckets[order[i]][river];
+            weaker[b]++;
+            tied[b]--;
+        }
+        start = end;
+    }
+    for (int b = 0; b < n; b++) {
+        for (int opp_b = 0; opp_b < n; opp_b++) {
+            if (bucket_sizes[river][b] > 0 && bucket_sizes[river][opp_b] > 0) {
+                chance.showdown(opp_b, b) = scores[b * n + opp_b]
+                    / ((double) bucket_sizes[river][b] * bucket_sizes[river][opp_b]);
+            }
+        }
+    }
+
+    return chance;
+}
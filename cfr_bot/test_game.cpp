@@ -2,9 +2,37 @@
 
 #include "cfr.h"
 #include "gametree.h"
+#include "vector_cfr.h"
+#include "batch_queue.h"
+#include "affinity.h"
+#include "mapped_infosets.h"
+#include "checkpoint.h"
+#include "fast_load.h"
 #include <bitset>
+#include <thread>
+#include <cstdlib>
+#include <new>
+#include <iomanip>
+#include <limits>
+#include <sys/stat.h>
 using namespace std;
 
+// heap allocations so far, counted by the replaced operator new (to check
+// that CFR traversals don't allocate)
+static long long num_allocations = 0;
+
+void* operator new(size_t size) {
+    num_allocations++;
+    if (void *p = malloc(size)) {
+        return p;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
 void test_immediate_fold() {
     int ante = 2*BIG_BLIND_;
     BoardActionHistory history(0, -1, ante);
@@ -111,7 +139,7 @@ void test_bb_raise_fold() {
 void test_allin_fold() {
     int ante = 2*BIG_BLIND_;
     BoardActionHistory history(0, -1, ante);
-    history.update(RAISE+1); // all-in
+    history.update(RAISE + RAISE_SIZES.size() - 1); // all-in
     assert(history.street == 0);
     assert(history.ind == 1);
     assert(history.pip[0] == STARTING_STACK_);
@@ -130,7 +158,7 @@ void test_allin_fold2() {
     int ante = 2*BIG_BLIND_;
     BoardActionHistory history(0, -1, ante);
     history.update(CHECK_CALL); // all-in
-    history.update(RAISE+1); // all-in
+    history.update(RAISE + RAISE_SIZES.size() - 1); // all-in
     assert(history.street == 0);
     assert(history.ind == 0);
     assert(history.pip[0] == BIG_BLIND_);
@@ -277,6 +305,1554 @@ void test_infoset_purification() {
 
 }
 
+// the mapped file answers lookups as the dict it was written from, and
+// missing or foreign files open empty
+void test_mapped_infosets() {
+    const string path = "test_mapped_infosets.map";
+    InfosetDictPure dict;
+    for (int i = 0; i < 10000; i++) {
+        ULL key = InfosetTable::hash_key(i) >> 1;
+        dict[key] = CFRInfosetPure(i % 4);
+    }
+    BoardActionHistory history(0, 0, 0);
+    ULL root_key = info_to_key(history.ind ^ history.button, history.street, 0, history);
+    dict.erase(root_key);
+    save_infosets_to_file_mapped(path, dict);
+
+    MappedInfosets mapped(path);
+    assert(mapped.size() == dict.size());
+    for (auto &kv : dict) {
+        assert(mapped.contains(kv.first));
+        assert(fetch_infoset(mapped, kv.first, 4).action == kv.second.action);
+    }
+
+    // keys not in the file get the dict's default
+    assert(!mapped.contains(root_key));
+    InfosetDictPure empty;
+    assert(fetch_infoset(mapped, root_key, 3).action == fetch_infoset(empty, root_key, 3).action);
+
+    // a file in another format isn't mapped
+    {
+        ofstream outfile(path);
+        outfile << "1 1 0.5 0.5 0.5 0.5" << endl;
+    }
+    MappedInfosets foreign(path);
+    assert(foreign.size() == 0 && !foreign.contains(dict.begin()->first));
+    remove(path.c_str());
+    MappedInfosets missing(path);
+    assert(missing.size() == 0);
+
+    cout << "\033[0;32m[PASSED test_mapped_infosets]\033[0m" << endl;
+}
+
+void test_infoset_table() {
+    // small table so the key array grows several times
+    InfosetTable table(16);
+    InfosetDict dict;
+
+    // keep refs across growth: entries live in the slab and never move
+    vector<CFRInfosetRef> refs;
+    for (int i = 0; i < 5000; i++) {
+        ULL key = InfosetTable::hash_key(i) >> 1;
+        int num_actions = 2 + i % 5;
+        refs.push_back(fetch_infoset(table, key, num_actions));
+        fetch_infoset(dict, key, num_actions);
+    }
+    assert(table.size() == 5000);
+
+    // same updates give the same regrets and strategies
+    for (int n = 0; n < 50000; n++) {
+        int i = random_below(5000);
+        ULL key = InfosetTable::hash_key(i) >> 1;
+        CFRInfosetRef infoset = fetch_infoset(table, key, 2 + i % 5);
+        assert(infoset.entry == refs[i].entry);
+        CFRInfoset &expected = dict[key];
+
+        vector<double> regrets(infoset.num_actions), strategy;
+        for (int a = 0; a < infoset.num_actions; a++) {
+            regrets[a] = random_unit() - 0.5;
+        }
+        strategy = infoset.get_regret_matching_strategy();
+        assert(strategy == expected.get_regret_matching_strategy());
+        infoset.record(regrets, strategy);
+        expected.record(regrets, strategy);
+    }
+
+    for (int i = 0; i < 5000; i++) {
+        ULL key = InfosetTable::hash_key(i) >> 1;
+        CFRInfosetRef infoset;
+        assert(table.find(key, infoset));
+        assert(infoset.t() == dict[key].t);
+        assert(infoset.get_avg_strategy() == dict[key].get_avg_strategy());
+    }
+    CFRInfosetRef missing;
+    assert(!table.find(InfosetTable::hash_key(5000) >> 1, missing));
+
+    // text format round trip, and the same text as the dict writes
+    stringstream ss;
+    ss << table;
+    InfosetTable loaded;
+    ss >> loaded;
+    assert(loaded.size() == table.size());
+    for (int i = 0; i < 5000; i++) {
+        ULL key = InfosetTable::hash_key(i) >> 1;
+        CFRInfosetRef infoset;
+        assert(loaded.find(key, infoset));
+        assert(infoset.t() == dict[key].t);
+    }
+
+    InfosetDict converted = infoset_table_to_dict(table);
+    assert(converted.size() == dict.size());
+    assert(converted.begin()->second.cumu_regrets == dict[converted.begin()->first].cumu_regrets);
+
+    cout << "\033[0;32m[PASSED test_infoset_table]\033[0m" << endl;
+}
+
+void test_infoset_table_concurrent() {
+    const int num_threads = 8;
+    const int num_keys = 20000;
+
+    // threads add overlapping keys at once: each key gets one entry, which
+    // every thread sees (the table is sized so it doesn't need to grow)
+    InfosetTable table;
+    table.reserve(num_keys);
+    vector<vector<double*>> seen(num_threads, vector<double*>(num_keys));
+    vector<thread> threads;
+    for (int n = 0; n < num_threads; n++) {
+        threads.push_back(thread([&table, &seen, n]() {
+            for (int j = 0; j < num_keys; j++) {
+                int i = (j * 7919 + n * 2500) % num_keys; // different order per thread
+                CFRInfosetRef infoset = table.fetch_concurrent(i, 2 + i % 5);
+                assert(infoset.num_actions == 2 + i % 5);
+                seen[n][i] = infoset.entry;
+            }
+        }));
+    }
+    for (thread &t : threads) {
+        t.join();
+    }
+
+    assert(table.size() == num_keys);
+    set<double*> entries;
+    for (int i = 0; i < num_keys; i++) {
+        for (int n = 1; n < num_threads; n++) {
+            assert(seen[n][i] == seen[0][i]);
+        }
+        entries.insert(seen[0][i]);
+    }
+    assert(entries.size() == num_keys);
+
+    // growing keeps every entry
+    assert(!table.needs_grow());
+    table.grow();
+    for (int i = 0; i < num_keys; i++) {
+        CFRInfosetRef infoset;
+        assert(table.find(i, infoset));
+        assert(infoset.entry == seen[0][i]);
+    }
+
+    cout << "\033[0;32m[PASSED test_infoset_table_concurrent]\033[0m" << endl;
+}
+
+// narrower storage tracks the double regrets and strategy sums to within
+// its precision
+template<class Storage>
+void check_regret_storage(double tolerance) {
+    InfosetTableT<Storage> table;
+    InfosetDict dict;
+
+    for (int n = 0; n < 20000; n++) {
+        int i = random_below(100);
+        int num_actions = 2 + i % 5;
+        CFRInfosetRefT<Storage> infoset = fetch_infoset(table, i, num_actions);
+        CFRInfoset &expected = fetch_infoset(dict, i, num_actions);
+
+        ActionValues regrets, strategy;
+        for (int a = 0; a < num_actions; a++) {
+            regrets[a] = 400 * (random_unit() - 0.5);
+        }
+        expected.get_regret_matching_strategy(strategy.data());
+        infoset.record(regrets.data(), strategy.data());
+        expected.record(regrets.data(), strategy.data());
+    }
+
+    for (int i = 0; i < 100; i++) {
+        CFRInfosetRefT<Storage> infoset;
+        assert(table.find(i, infoset));
+        CFRInfoset &expected = dict[i];
+        assert(infoset.t() == expected.t);
+        for (int a = 0; a < infoset.num_actions; a++) {
+            assert(abs(infoset.regret(a) - expected.cumu_regrets[a]) < tolerance);
+            assert(abs(infoset.strategy_sum(a) - expected.cumu_strategy[a]) < tolerance);
+        }
+    }
+}
+
+void test_regret_storage() {
+    check_regret_storage<DoubleStorage>(1e-12);
+    check_regret_storage<FloatStorage>(1e-4);
+    check_regret_storage<FixedStorage>(1e-4);
+
+    // fixed point saturates instead of wrapping around
+    assert(FixedStorage::load(FixedStorage::store(1e6)) > 500);
+    assert(FixedStorage::load(FixedStorage::store(-1e6)) < -500);
+    assert(FixedStorage::load(FixedStorage::store(-0.25)) == -0.25);
+
+    // storage halves the slab entry
+    assert(sizeof(CFRInfosetRefT<FloatStorage>::Value) == 4);
+    assert(sizeof(CFRInfosetRefT<FixedStorage>::Value) == 4);
+
+    cout << "\033[0;32m[PASSED test_regret_storage]\033[0m" << endl;
+}
+
+// record's running averages match the update rules written out as plain
+// sums over visits n = 1, 2, ... (up to scale, which regret matching and the
+// average strategy ignore)
+void check_update_rule(const CFRUpdateRule &rule) {
+    const int num_actions = 3;
+    CFRInfoset infoset(num_actions);
+    double sum_regrets[num_actions] = {}, sum_strategy[num_actions] = {};
+
+    for (int n = 1; n <= 500; n++) {
+        ActionValues regrets, strategy;
+        infoset.get_regret_matching_strategy(strategy.data());
+        for (int a = 0; a < num_actions; a++) {
+            regrets[a] = 2 * random_unit() - 1;
+        }
+        infoset.record(regrets.data(), strategy.data(), rule);
+
+        for (int a = 0; a < num_actions; a++) {
+            switch (rule.type) {
+            case CFRUpdateRule::VANILLA:
+                sum_regrets[a] += regrets[a];
+                sum_strategy[a] += strategy[a];
+                break;
+            case CFRUpdateRule::LINEAR:
+                sum_regrets[a] += n * regrets[a];
+                sum_strategy[a] += n * strategy[a];
+                break;
+            case CFRUpdateRule::CFR_PLUS:
+                sum_regrets[a] = max(sum_regrets[a] + regrets[a], 0.0);
+                sum_strategy[a] += n * strategy[a];
+                break;
+            case CFRUpdateRule::DISCOUNTED:
+                double exponent = (sum_regrets[a] > 0) ? rule.alpha : rule.beta;
+                double discount = pow(n-1, exponent) / (pow(n-1, exponent) + 1);
+                sum_regrets[a] = sum_regrets[a] * discount + regrets[a];
+                sum_strategy[a] = sum_strategy[a] * pow((n-1) / (double) n, rule.gamma) + strategy[a];
+                break;
+            }
+        }
+
+        CFRInfoset expected({sum_regrets, sum_regrets + num_actions},
+                            {sum_strategy, sum_strategy + num_actions}, n);
+        vector<double> strategy_now = infoset.get_regret_matching_strategy();
+        vector<double> expected_now = expected.get_regret_matching_strategy();
+        vector<double> avg = infoset.get_avg_strategy();
+        vector<double> expected_avg = expected.get_avg_strategy();
+        for (int a = 0; a < num_actions; a++) {
+            assert(abs(strategy_now[a] - expected_now[a]) < 1e-9);
+            assert(abs(avg[a] - expected_avg[a]) < 1e-9);
+            // averages stay in range (binary.h stores strategy sums in [0, 1])
+            assert(abs(infoset.cumu_regrets[a]) <= 1);
+            assert(infoset.cumu_strategy[a] >= 0 && infoset.cumu_strategy[a] <= 1);
+            if (rule.type == CFRUpdateRule::CFR_PLUS) {
+                assert(infoset.cumu_regrets[a] >= 0);
+            }
+            // the sums themselves, as pruning compares them in chips
+            assert(abs(infoset.cumulative_regret(a, rule) - sum_regrets[a])
+                   <= 1e-9 * max(1.0, abs(sum_regrets[a])));
+        }
+    }
+}
+
+void test_update_rules() {
+    check_update_rule(CFRUpdateRule(CFRUpdateRule::VANILLA));
+    check_update_rule(CFRUpdateRule(CFRUpdateRule::LINEAR));
+    check_update_rule(CFRUpdateRule(CFRUpdateRule::CFR_PLUS));
+    check_update_rule(CFRUpdateRule(CFRUpdateRule::DISCOUNTED, 1.5, 0, 2));
+    check_update_rule(CFRUpdateRule(CFRUpdateRule::DISCOUNTED, 1, 1, 1));
+
+    // the default rule is the original plain average
+    CFRInfoset infoset(2);
+    double regrets[2] = {1, -1}, strategy[2] = {0.5, 0.5};
+    infoset.record(regrets, strategy);
+    infoset.record(regrets, strategy);
+    assert(infoset.cumu_regrets[0] == 1 && infoset.cumu_regrets[1] == -1);
+
+    cout << "\033[0;32m[PASSED test_update_rules]\033[0m" << endl;
+}
+
+// shards training from one base table: merging their deltas into the base
+// gives what one table seeing all their visits would have (VANILLA)
+void test_merge_infosets() {
+    const int num_actions = 3;
+    InfosetDict base, shard1, shard2;
+    CFRInfoset expected(num_actions);
+    auto visit = [&expected](CFRInfoset &infoset, bool also_expected) {
+        ActionValues regrets, strategy;
+        for (int a = 0; a < num_actions; a++) {
+            regrets[a] = 2 * random_unit() - 1;
+            strategy[a] = random_unit();
+        }
+        infoset.record(regrets.data(), strategy.data());
+        if (also_expected) {
+            expected.record(regrets.data(), strategy.data());
+        }
+    };
+
+    base[1] = CFRInfoset(num_actions);
+    for (int n = 0; n < 5; n++) {
+        visit(base[1], true);
+    }
+    shard1 = shard2 = base;
+    for (int n = 0; n < 7; n++) {
+        visit(shard1[1], true);
+    }
+    for (int n = 0; n < 3; n++) {
+        visit(shard2[1], true);
+    }
+    shard2[2] = CFRInfoset(num_actions); // only visited by one shard
+    visit(shard2[2], false);
+
+    InfosetDict deltas1 = get_infoset_deltas(shard1, base);
+    InfosetDict deltas2 = get_infoset_deltas(shard2, base);
+    assert(deltas1.size() == 1 && deltas1[1].t == 7);
+    assert(deltas2.size() == 2 && deltas2[1].t == 3 && deltas2[2].t == 1);
+
+    InfosetDict merged = base;
+    merge_infosets(merged, deltas1);
+    merge_infosets(merged, deltas2);
+    assert(merged.size() == 2);
+    assert(merged[1].t == expected.t && merged[1].t == 15);
+    for (int a = 0; a < num_actions; a++) {
+        assert(abs(merged[1].cumu_regrets[a] - expected.cumu_regrets[a]) < 1e-12);
+        assert(abs(merged[1].cumu_strategy[a] - expected.cumu_strategy[a]) < 1e-12);
+        assert(merged[2].cumu_regrets[a] == shard2[2].cumu_regrets[a]);
+    }
+
+    // merging whole tables weighs each by its visits
+    InfosetDict merged_tables = shard1;
+    merge_infosets(merged_tables, shard2);
+    assert(merged_tables[1].t == 20);
+    for (int a = 0; a < num_actions; a++) {
+        double average = (12 * shard1[1].cumu_regrets[a] + 8 * shard2[1].cumu_regrets[a]) / 20;
+        assert(abs(merged_tables[1].cumu_regrets[a] - average) < 1e-12);
+    }
+
+    cout << "\033[0;32m[PASSED test_merge_infosets]\033[0m" << endl;
+}
+
+// flat node matches the recursive one, with all its descendants; marks the
+// action slots of decision nodes in used (per street)
+void check_flat_game_tree(const FlatGameTree &tree, const FlatGameNode &flat,
+                          const GameTreeNode &node, array<vector<int>, NUM_STREETS> &used) {
+    assert(flat.history_key == node.history_key);
+    assert(flat.won == node.won);
+    assert(flat.ind == node.ind);
+    assert(flat.street == node.street);
+    assert(flat.finished == node.finished);
+    assert(flat.showdown == node.showdown);
+    assert(flat.num_children == node.children.size());
+
+    for (int i = 0; i < flat.num_children; i++) {
+        used[flat.street][flat.action_base + i]++;
+        check_flat_game_tree(tree, tree.child(flat, i), node.children[i], used);
+    }
+}
+
+int count_game_tree_nodes(const GameTreeNode &node) {
+    int count = 1;
+    for (int i = 0; i < node.children.size(); i++) {
+        count += count_game_tree_nodes(node.children[i]);
+    }
+    return count;
+}
+
+void test_flat_game_tree() {
+    BoardActionHistory river_history(0, 0, 0);
+    for (int i = 0; i < 7; i++) {
+        river_history.update(CHECK_CALL);
+    }
+    vector<BoardActionHistory> histories = {
+        BoardActionHistory(0, 0, 0), BoardActionHistory(1, 0, 0), river_history};
+
+    for (BoardActionHistory &history : histories) {
+        GameTreeNode root = build_game_tree(history);
+        FlatGameTree tree(history);
+        assert(tree.nodes.size() == count_game_tree_nodes(root));
+
+        // every action slot of a street belongs to exactly one decision node
+        array<vector<int>, NUM_STREETS> used;
+        for (int street = 0; street < NUM_STREETS; street++) {
+            used[street].assign(tree.num_action_slots[street], 0);
+        }
+        check_flat_game_tree(tree, tree.root(), root, used);
+        for (int street = 0; street < NUM_STREETS; street++) {
+            for (int count : used[street]) {
+                assert(count == 1);
+            }
+        }
+
+        // and each decision node has its own index on its street
+        array<vector<int>, NUM_STREETS> decisions;
+        for (int street = 0; street < NUM_STREETS; street++) {
+            decisions[street].assign(tree.num_decisions[street], 0);
+        }
+        for (const FlatGameNode &node : tree.nodes) {
+            if (node.num_children > 0) {
+                decisions[node.street][node.decision_index]++;
+            }
+        }
+        for (int street = 0; street < NUM_STREETS; street++) {
+            for (int count : decisions[street]) {
+                assert(count == 1);
+            }
+        }
+    }
+    assert(sizeof(FlatGameNode) <= 32);
+
+    cout << "\033[0;32m[PASSED test_flat_game_tree]\033[0m" << endl;
+}
+
+// a node's infoset as multi_mccfr fetches it from either table
+CFRInfosetRef fetch_node_infoset(InfosetTable &infosets, const FlatGameNode &node, int card_info) {
+    return infosets.fetch_concurrent(info_to_key(node.history_key, card_info), node.num_children);
+}
+
+CFRInfosetRef fetch_node_infoset(DenseInfosetTable &infosets, const FlatGameNode &node, int card_info) {
+    return infosets.at(node, card_info);
+}
+
+// same steps per node as mccfr() in multi_mccfr.cpp: external sampling,
+// traverser in seat 0
+template<class Table>
+pair<double, double> sampled_traversal(int winner, const FlatGameTree &tree,
+                                       const FlatGameNode &node,
+                                       array<int, NUM_STREETS> &card_info_state1,
+                                       array<int, NUM_STREETS> &card_info_state2,
+                                       Table &infosets) {
+    if (node.num_children == 0) {
+        if (!node.showdown) {
+            return make_pair(node.won, -node.won);
+        }
+        int winner_mult = (winner == 0) ? 1 : -1;
+        return make_pair(node.won * winner_mult, -node.won * winner_mult);
+    }
+
+    auto& card_info_state = (node.ind == 0) ? card_info_state1 : card_info_state2;
+    CFRInfosetRef infoset = fetch_node_infoset(infosets, node, card_info_state[node.street]);
+
+    if (node.ind == 0) {
+        ActionValues strategy;
+        infoset.get_regret_matching_strategy(strategy.data());
+
+        ActionValues utils;
+        pair<double, double> tot_val = {0, 0};
+        for (int i = 0; i < node.num_children; i++) {
+            auto sub_val = sampled_traversal(winner, tree, tree.child(node, i),
+                                             card_info_state1, card_info_state2, infosets);
+            tot_val = tot_val + strategy[i]*sub_val;
+            utils[i] = sub_val.first;
+        }
+        for (int i = 0; i < node.num_children; i++) {
+            utils[i] -= tot_val.first;
+        }
+        infoset.record(utils.data(), strategy.data());
+        return tot_val;
+    }
+    else {
+        int action = infoset.get_action_index(0.1);
+        return sampled_traversal(winner, tree, tree.child(node, action),
+                                 card_info_state1, card_info_state2, infosets);
+    }
+}
+
+// same steps per node as Subgame::subgame_cfr: both players traversed
+pair<double, double> full_traversal(int winner, const FlatGameTree &tree,
+                                    const FlatGameNode &node,
+                                    int card_key1, int card_key2,
+                                    InfosetDict &infosets) {
+    if (node.num_children == 0) {
+        if (!node.showdown) {
+            return make_pair(node.won, -node.won);
+        }
+        int winner_mult = (winner == 0) ? 1 : -1;
+        return make_pair(node.won * winner_mult, -node.won * winner_mult);
+    }
+
+    int card_key = (node.ind == 0) ? card_key1 : card_key2;
+    ULL key = info_to_key(node.history_key, card_key);
+    CFRInfoset& infoset = fetch_infoset(infosets, key, node.num_children);
+
+    ActionValues strategy;
+    infoset.get_regret_matching_strategy(strategy.data());
+
+    ActionValues utils;
+    pair<double, double> tot_val = {0, 0};
+    for (int i = 0; i < node.num_children; i++) {
+        auto sub_val = full_traversal(winner, tree, tree.child(node, i), card_key1, card_key2, infosets);
+        tot_val = tot_val + strategy[i]*sub_val;
+        utils[i] = sub_val.first;
+    }
+    for (int i = 0; i < node.num_children; i++) {
+        utils[i] -= tot_val.first;
+    }
+    infoset.record(utils.data(), strategy.data());
+    return tot_val;
+}
+
+void test_traversal_allocations() {
+    array<FlatGameTree, 2> trees;
+    for (int btn = 0; btn < 2; btn++) {
+        BoardActionHistory history(btn, 0, 0);
+        trees[btn] = FlatGameTree(history);
+    }
+
+    // sampled traversals of the full tree: new infosets take slab space that
+    // was allocated up front, visits to existing ones allocate nothing
+    InfosetTable table;
+    table.reserve(1 << 20);
+    table.fetch_concurrent(0, 2); // allocates the first slab block
+    long long start = num_allocations;
+    for (int n = 0; n < 2000; n++) {
+        array<int, NUM_STREETS> c1, c2;
+        for (int street = 0; street < NUM_STREETS; street++) {
+            c1[street] = random_below(8);
+            c2[street] = random_below(8);
+        }
+        sampled_traversal(random_below(2), trees[n % 2], trees[n % 2].root(), c1, c2, table);
+    }
+    assert(num_allocations == start);
+
+    // full traversals of a river subtree (as in the player's subgame solve):
+    // only the first one allocates, to add infosets to the dict
+    BoardActionHistory history(0, 0, 0);
+    for (int i = 0; i < 7; i++) {
+        history.update(CHECK_CALL);
+    }
+    assert(history.street == 3);
+    FlatGameTree river_tree(history);
+
+    InfosetDict dict;
+    full_traversal(0, river_tree, river_tree.root(), 1, 2, dict);
+    start = num_allocations;
+    for (int n = 0; n < 100; n++) {
+        full_traversal(n % 2, river_tree, river_tree.root(), 1, 2, dict);
+    }
+    assert(num_allocations == start);
+
+    cout << "\033[0;32m[PASSED test_traversal_allocations with "
+        << table.size() << " + " << dict.size() << " infosets]\033[0m" << endl;
+}
+
+void test_batch_queue() {
+    // producers push numbered items in batches through a small queue, so
+    // both sides have to wait; every item arrives exactly once
+    const int num_producers = 3, num_consumers = 2, batches_per_producer = 200, batch_size = 16;
+    BatchQueue<int> queue(2);
+    vector<thread> threads;
+    for (int p = 0; p < num_producers; p++) {
+        threads.push_back(thread([&queue, p]() {
+            vector<int> batch;
+            for (int i = 0; i < batches_per_producer * batch_size; i++) {
+                batch.push_back(p * batches_per_producer * batch_size + i);
+                if (batch.size() == batch_size) {
+                    queue.push(batch);
+                    assert(batch.empty());
+                }
+            }
+        }));
+    }
+    vector<vector<int>> received(num_consumers);
+    vector<thread> consumers;
+    for (int c = 0; c < num_consumers; c++) {
+        consumers.push_back(thread([&queue, &received, c]() {
+            vector<int> batch;
+            while (queue.pop(batch)) {
+                assert(batch.size() == batch_size);
+                received[c].insert(received[c].end(), batch.begin(), batch.end());
+            }
+        }));
+    }
+    for (thread &t : threads) {
+        t.join();
+    }
+    // consumers drain what's left, then their pops fail
+    queue.close();
+    for (thread &t : consumers) {
+        t.join();
+    }
+
+    vector<int> all;
+    for (auto &items : received) {
+        all.insert(all.end(), items.begin(), items.end());
+    }
+    sort(all.begin(), all.end());
+    assert(all.size() == num_producers * batches_per_producer * batch_size);
+    for (int i = 0; i < all.size(); i++) {
+        assert(all[i] == i);
+    }
+    BatchQueueStats stats = queue.get_stats();
+    assert(stats.batches == num_producers * batches_per_producer);
+    assert(stats.items == all.size());
+
+    // a closed queue drops pushes
+    vector<int> batch = {1, 2};
+    queue.push(batch);
+    assert(batch.empty() && !queue.pop(batch));
+
+    cout << "\033[0;32m[PASSED test_batch_queue " << stats << "]\033[0m" << endl;
+}
+
+// cpu lists as sysfs writes them, and pinning to the allowed cpus
+void test_affinity() {
+    assert(parse_cpu_list("0") == vector<int>({0}));
+    assert(parse_cpu_list("0-3,8,10-11\n") == vector<int>({0, 1, 2, 3, 8, 10, 11}));
+    assert(parse_cpu_list("").empty());
+
+    vector<int> cpus = get_allowed_cpus();
+    assert(!cpus.empty());
+    assert(is_sorted(cpus.begin(), cpus.end()));
+    vector<int> nodes = get_cpu_nodes(cpus.back());
+    assert(nodes.size() == cpus.back() + 1);
+
+    // node numbers with a gap (nodes 0 and 2), as on some multi-socket machines
+    const string node_dir = "test_affinity_nodes";
+    for (string dir : {node_dir, node_dir + "/node0", node_dir + "/node2"}) {
+        mkdir(dir.c_str(), 0755);
+    }
+    ofstream(node_dir + "/online") << "0,2" << endl;
+    ofstream(node_dir + "/node0/cpulist") << "0-1" << endl;
+    ofstream(node_dir + "/node2/cpulist") << "2-3" << endl;
+    assert(get_cpu_nodes(3, node_dir) == vector<int>({0, 0, 2, 2}));
+    for (string file : {"/node0/cpulist", "/node2/cpulist", "/online", "/node0", "/node2", ""}) {
+        remove((node_dir + file).c_str());
+    }
+    assert(get_cpu_nodes(3, node_dir) == vector<int>(4, 0));
+
+    thread pinned([&cpus]() {
+        assert(pin_thread(vector<int>(1, cpus[0])));
+        assert(get_allowed_cpus() == vector<int>(1, cpus[0]));
+    });
+    pinned.join();
+
+    cout << "\033[0;32m[PASSED test_affinity " << cpus.size() << " cpus]\033[0m" << endl;
+}
+
+void test_dense_infoset_table() {
+    array<FlatGameTree, 2> trees;
+    for (int btn = 0; btn < 2; btn++) {
+        BoardActionHistory history(btn, 0, 0);
+        trees[btn] = FlatGameTree(history);
+    }
+    array<int, NUM_STREETS> num_card_infos = {6, 5, 4, 3};
+    DenseInfosetTable dense(trees[0], num_card_infos);
+    assert(dense.covers(trees[1]));
+    assert(dense.size() == 0);
+
+    vector<array<int, NUM_STREETS>> c1(3000), c2(3000);
+    for (int n = 0; n < 3000; n++) {
+        for (int street = 0; street < NUM_STREETS; street++) {
+            c1[n][street] = random_below(num_card_infos[street]);
+            c2[n][street] = random_below(num_card_infos[street]);
+        }
+    }
+
+    // the same traversals train the same infosets as the hashed table, and
+    // fetching from the dense table never allocates
+    InfosetTable table;
+    table.reserve(1 << 20);
+    gen.seed(5);
+    for (int n = 0; n < 3000; n++) {
+        sampled_traversal(n % 2, trees[n % 2], trees[n % 2].root(), c1[n], c2[n], table);
+    }
+    gen.seed(5);
+    long long start = num_allocations;
+    for (int n = 0; n < 3000; n++) {
+        sampled_traversal(n % 2, trees[n % 2], trees[n % 2].root(), c1[n], c2[n], dense);
+    }
+    assert(num_allocations == start);
+
+    // (the hashed table also holds the opponent's infosets that were fetched
+    // but never recorded, with t = 0, which the dense table doesn't export)
+    InfosetDict expected = infoset_table_to_dict(table);
+    for (auto it = expected.begin(); it != expected.end();) {
+        it = (it->second.t == 0) ? expected.erase(it) : next(it);
+    }
+    InfosetDict exported = infoset_table_to_dict(dense);
+    assert(dense.size() == expected.size());
+    assert(exported.size() == expected.size());
+    for (auto &kv : expected) {
+        assert(exported.count(kv.first));
+        assert(exported[kv.first].t == kv.second.t);
+        assert(exported[kv.first].cumu_regrets == kv.second.cumu_regrets);
+        assert(exported[kv.first].cumu_strategy == kv.second.cumu_strategy);
+
+        CFRInfosetRef infoset;
+        assert(dense.find(kv.first, infoset));
+        assert(infoset.get_avg_strategy() == kv.second.get_avg_strategy());
+    }
+
+    // text checkpoints load into either table
+    stringstream ss;
+    ss << dense;
+    InfosetTable loaded_table;
+    ss >> loaded_table;
+    assert(loaded_table.size() == expected.size());
+
+    stringstream ss2;
+    ss2 << table;
+    DenseInfosetTable loaded(trees[0], num_card_infos);
+    ss2 >> loaded;
+    assert(loaded.size() == expected.size());
+    for (auto &kv : expected) {
+        CFRInfosetRef infoset;
+        assert(loaded.find(kv.first, infoset));
+        assert(infoset.t() == kv.second.t);
+    }
+
+    // keys outside the tree or the card infos aren't stored
+    CFRInfosetRef infoset;
+    vector<double> values = {0, 0};
+    assert(!dense.find(info_to_key(trees[0].root().history_key, num_card_infos[0]), infoset));
+    assert(!dense.insert(info_to_key(trees[0].root().history_key, num_card_infos[0]), 1, values, values));
+    const FlatGameNode &leaf = *find_if(trees[0].nodes.begin(), trees[0].nodes.end(),
+        [](const FlatGameNode &node) { return node.num_children == 0; });
+    assert(!dense.insert(info_to_key(leaf.history_key, 0), 1, values, values));
+
+    dense.clear();
+    assert(dense.size() == 0);
+
+    cout << "\033[0;32m[PASSED test_dense_infoset_table with " << expected.size() << " of "
+        << dense.num_entries() << " infosets visited]\033[0m" << endl;
+}
+
+// binary checkpoints written by several threads reload exactly into either
+// table, and a damaged one isn't loaded
+void test_checkpoint() {
+    array<FlatGameTree, 2> trees;
+    for (int btn = 0; btn < 2; btn++) {
+        BoardActionHistory history(btn, 0, 0);
+        trees[btn] = FlatGameTree(history);
+    }
+    array<int, NUM_STREETS> num_card_infos = {6, 5, 4, 3};
+    DenseInfosetTable dense(trees[0], num_card_infos);
+    for (int n = 0; n < 2000; n++) {
+        array<int, NUM_STREETS> c1, c2;
+        for (int street = 0; street < NUM_STREETS; street++) {
+            c1[street] = random_below(num_card_infos[street]);
+            c2[street] = random_below(num_card_infos[street]);
+        }
+        sampled_traversal(n % 2, trees[n % 2], trees[n % 2].root(), c1, c2, dense);
+    }
+    InfosetDict expected = infoset_table_to_dict(dense);
+
+    const string path = "test_checkpoint.ckpt";
+    for (int num_threads : {1, 3, 8}) {
+        assert(save_infosets_to_file_ckpt(path, dense, num_threads));
+        DenseInfosetTable loaded_dense(trees[0], num_card_infos);
+        assert(load_infosets_from_file_ckpt(path, loaded_dense));
+        InfosetDict exported = infoset_table_to_dict(loaded_dense);
+        assert(exported.size() == expected.size());
+        for (auto &kv : expected) {
+            assert(exported[kv.first].t == kv.second.t);
+            assert(exported[kv.first].cumu_regrets == kv.second.cumu_regrets);
+            assert(exported[kv.first].cumu_strategy == kv.second.cumu_strategy);
+        }
+
+        // through the hashed table and back
+        InfosetTable table;
+        table.reserve(1 << 16);
+        assert(load_infosets_from_file_ckpt(path, table));
+        assert(table.size() == expected.size());
+        assert(save_infosets_to_file_ckpt(path, table, num_threads));
+        loaded_dense.clear();
+        assert(load_infosets_from_file_ckpt(path, loaded_dense));
+        assert(infoset_table_to_dict(loaded_dense).size() == expected.size());
+    }
+
+    // the tools load checkpoints into an InfosetDict, and pick the format
+    // by the name
+    assert(is_checkpoint_path(path));
+    assert(!is_checkpoint_path("test_checkpoint.txt"));
+    assert(!is_checkpoint_path("ckpt"));
+    assert(save_infosets_to_file_ckpt(path, dense, 3));
+    const string text_path = "test_checkpoint.txt";
+    {
+        ofstream outfile(text_path);
+        outfile << setprecision(numeric_limits<double>::max_digits10) << dense;
+    }
+    for (const string &load_path : {path, text_path}) {
+        InfosetDict dict;
+        assert(load_infosets_from_file_any(load_path, dict));
+        assert(dict.size() == expected.size());
+        for (auto &kv : expected) {
+            assert(dict[kv.first].t == kv.second.t);
+            assert(dict[kv.first].cumu_regrets == kv.second.cumu_regrets);
+            assert(dict[kv.first].cumu_strategy == kv.second.cumu_strategy);
+        }
+    }
+    remove(text_path.c_str());
+
+    // one flipped byte fails its shard's checksum
+    {
+        fstream file(path, ios::in | ios::out | ios::binary);
+        file.seekp(-5, ios::end);
+        char c;
+        file.read(&c, 1);
+        c ^= 1;
+        file.seekp(-5, ios::end);
+        file.write(&c, 1);
+    }
+    DenseInfosetTable damaged(trees[0], num_card_infos);
+    assert(!load_infosets_from_file_ckpt(path, damaged));
+    assert(damaged.size() == 0);
+    remove(path.c_str());
+    assert(!load_infosets_from_file_ckpt(path, damaged));
+
+    cout << "\033[0;32m[PASSED test_checkpoint with " << expected.size() << " infosets]\033[0m" << endl;
+}
+
+void assert_same_infosets(InfosetDict &a, InfosetDict &b) {
+    assert(a.size() == b.size());
+    for (auto &kv : a) {
+        assert(b.count(kv.first));
+        assert(b[kv.first].t == kv.second.t);
+        assert(b[kv.first].cumu_regrets == kv.second.cumu_regrets);
+        assert(b[kv.first].cumu_strategy == kv.second.cumu_strategy);
+    }
+}
+
+void test_fast_load() {
+    // numbers parse as strtod would
+    for (string number : {"0", "-0", "7", "0.5", "-1.25e-05", "123456", "1e+22", "3e-300",
+                          "0.1000000000000000055511151231257827", "123456789012345678",
+                          "1.7976931348623157e+308", "4.9406564584124654e-324", "-inf"}) {
+        double value;
+        const char *end = parse_double(number.data(), number.data() + number.size(), value);
+        assert(end == number.data() + number.size());
+        double expected = strtod(number.c_str(), nullptr);
+        assert(memcmp(&value, &expected, sizeof(value)) == 0);
+    }
+    for (string number : {"", "-", "1.5x", "e5"}) {
+        double value;
+        assert(parse_double(number.data(), number.data() + number.size(), value) == nullptr);
+    }
+
+    array<FlatGameTree, 2> trees;
+    for (int btn = 0; btn < 2; btn++) {
+        BoardActionHistory history(btn, 0, 0);
+        trees[btn] = FlatGameTree(history);
+    }
+    array<int, NUM_STREETS> num_card_infos = {6, 5, 4, 3};
+    DenseInfosetTable dense(trees[0], num_card_infos);
+    for (int n = 0; n < 2000; n++) {
+        array<int, NUM_STREETS> c1, c2;
+        for (int street = 0; street < NUM_STREETS; street++) {
+            c1[street] = random_below(num_card_infos[street]);
+            c2[street] = random_below(num_card_infos[street]);
+        }
+        sampled_traversal(n % 2, trees[n % 2], trees[n % 2].root(), c1, c2, dense);
+    }
+
+    // the same infosets as load_infosets_from_file, with the default
+    // precision and with every digit
+    const string path = "test_fast_load.txt";
+    for (int precision : {6, numeric_limits<double>::max_digits10}) {
+        {
+            ofstream outfile(path);
+            outfile << setprecision(precision) << dense;
+        }
+        InfosetDict expected;
+        load_infosets_from_file(path, expected);
+        for (int num_threads : {1, 3, 8}) {
+            InfosetDict dict;
+            assert(load_infosets_from_file_fast(path, dict, num_threads));
+            assert_same_infosets(expected, dict);
+
+            InfosetTable table;
+            assert(load_infosets_from_file_fast(path, table, num_threads));
+            InfosetDict exported = infoset_table_to_dict(table);
+            assert_same_infosets(expected, exported);
+
+            DenseInfosetTable loaded_dense(trees[0], num_card_infos);
+            assert(load_infosets_from_file_fast(path, loaded_dense, num_threads));
+            exported = infoset_table_to_dict(loaded_dense);
+            assert_same_infosets(expected, exported);
+        }
+    }
+
+    // blank and malformed lines are skipped, CRLF and a missing last
+    // newline are read
+    {
+        ofstream outfile(path);
+        outfile << "1 2 0.5 1.5 -0.25 3 \n\n";
+        outfile << "2 1 0.5\n";
+        outfile << "3 x 0.5 0.5\n";
+        outfile << "4 1 0.5 0.5 oops 1\n";
+        outfile << "5 4 1 2\r\n";
+        outfile << "6 1 2 3 4 5";
+    }
+    for (int num_threads : {1, 2, 16}) {
+        InfosetDict dict;
+        assert(load_infosets_from_file_fast(path, dict, num_threads));
+        assert(dict.size() == 3);
+        assert(dict[1].t == 2 && dict[1].cumu_regrets == vector<double>({0.5, -0.25}));
+        assert(dict[1].cumu_strategy == vector<double>({1.5, 3}));
+        assert(dict[5].t == 4 && dict[5].cumu_regrets == vector<double>({1}));
+        assert(dict[6].cumu_strategy == vector<double>({3, 5}));
+    }
+
+    // the last of repeated keys wins, across batches and chunks, and an
+    // empty file loads nothing
+    const int num_repeated = 3 * FAST_LOAD_DICT_BATCH;
+    {
+        ofstream outfile(path);
+        for (int i = 0; i < num_repeated; i++) {
+            outfile << i % 7 << " " << i << " 0.5 0.5\n";
+        }
+    }
+    for (int num_threads : {1, 3, 8}) {
+        InfosetDict dict;
+        assert(load_infosets_from_file_fast(path, dict, num_threads));
+        assert(dict.size() == 7);
+        for (int key = 0; key < 7; key++) {
+            assert(dict[key].t == num_repeated - 1 - (num_repeated - 1 - key) % 7);
+        }
+    }
+    {
+        ofstream outfile(path);
+    }
+    InfosetDict empty;
+    assert(load_infosets_from_file_fast(path, empty, 4));
+    assert(empty.size() == 0);
+    remove(path.c_str());
+    InfosetDict missing;
+    assert(!load_infosets_from_file_fast(path, missing));
+
+    cout << "\033[0;32m[PASSED test_fast_load with " << dense.size() << " infosets]\033[0m" << endl;
+}
+
+// expected value for seat 0 with both players' buckets known, walking the
+// bucket transitions as explicit chance nodes (reference for vector_cfr)
+double bucket_pair_value(const FlatGameTree &tree, const FlatGameNode &node, int street,
+                         int b0, int b1, BoardChance &chance, DenseInfosetTable &infosets) {
+    int node_street = min((int) node.street, NUM_STREETS-1);
+    if (street < node_street) {
+        double value = 0;
+        for (int next_b0 = 0; next_b0 < chance.num_buckets[street+1]; next_b0++) {
+            for (int next_b1 = 0; next_b1 < chance.num_buckets[street+1]; next_b1++) {
+                double prob = chance.transition(street, b0, next_b0) * chance.transition(street, b1, next_b1);
+                if (prob > 0) {
+                    value += prob * bucket_pair_value(tree, node, street+1, next_b0, next_b1, chance, infosets);
+                }
+            }
+        }
+        return value;
+    }
+    if (node.num_children == 0) {
+        return node.showdown ? node.won * chance.showdown(b1, b0) : node.won;
+    }
+
+    vector<double> strategy = infosets.at(node, node.ind == 0 ? b0 : b1).get_regret_matching_strategy();
+    double value = 0;
+    for (int i = 0; i < node.num_children; i++) {
+        value += strategy[i] * bucket_pair_value(tree, tree.child(node, i), street, b0, b1, chance, infosets);
+    }
+    return value;
+}
+
+// random chance over few buckets per street
+BoardChance random_board_chance(const array<int, NUM_STREETS> &num_buckets) {
+    BoardChance chance(num_buckets);
+    for (int street = 0; street < NUM_STREETS; street++) {
+        double total = 0;
+        for (int b = 0; b < num_buckets[street]; b++) {
+            chance.prior[street][b] = random_unit();
+            total += chance.prior[street][b];
+        }
+        for (int b = 0; b < num_buckets[street]; b++) {
+            chance.prior[street][b] /= total;
+        }
+    }
+    for (int street = 0; street < NUM_STREETS-1; street++) {
+        for (int b = 0; b < num_buckets[street]; b++) {
+            double total = 0;
+            for (int next_b = 0; next_b < num_buckets[street+1]; next_b++) {
+                chance.transition(street, b, next_b) = random_unit();
+                total += chance.transition(street, b, next_b);
+            }
+            for (int next_b = 0; next_b < num_buckets[street+1]; next_b++) {
+                chance.transition(street, b, next_b) /= total;
+            }
+        }
+    }
+    int n = num_buckets[NUM_STREETS-1];
+    for (int b = 0; b < n; b++) {
+        for (int opp_b = 0; opp_b < b; opp_b++) {
+            chance.showdown(opp_b, b) = 2*random_unit() - 1;
+            chance.showdown(b, opp_b) = -chance.showdown(opp_b, b);
+        }
+    }
+    return chance;
+}
+
+void test_vector_cfr() {
+    // subtree from the turn, so the reference can enumerate bucket pairs
+    BoardActionHistory history(0, 0, 0);
+    while (history.street < 2) {
+        history.update(CHECK_CALL);
+    }
+    FlatGameTree tree(history);
+    int street = tree.root().street;
+    array<int, NUM_STREETS> num_buckets = {2, 2, 3, 4};
+    DenseInfosetTable infosets(tree, num_buckets);
+
+    // train on random boards so strategies aren't uniform
+    for (int n = 0; n < 20; n++) {
+        BoardChance chance = random_board_chance(num_buckets);
+        BucketValues values;
+        vector_cfr(tree, tree.root(), street, chance, chance.prior[street], chance.prior[street],
+                   infosets, values);
+    }
+    assert(infosets.size() > 0);
+
+    // values per bucket are the reference's, averaged over the opponent's
+    // buckets (the traversal records each infoset after reading it, so the
+    // reference sees the same strategies)
+    BoardChance chance = random_board_chance(num_buckets);
+    vector<double> expected(num_buckets[street], 0);
+    for (int b0 = 0; b0 < num_buckets[street]; b0++) {
+        for (int b1 = 0; b1 < num_buckets[street]; b1++) {
+            expected[b0] += chance.prior[street][b1]
+                * bucket_pair_value(tree, tree.root(), street, b0, b1, chance, infosets);
+        }
+    }
+    BucketValues values;
+    vector_cfr(tree, tree.root(), street, chance, chance.prior[street], chance.prior[street],
+               infosets, values);
+    for (int b = 0; b < num_buckets[street]; b++) {
+        assert(fabs(values[b] - expected[b]) < 1e-9 * (1 + fabs(expected[b])));
+    }
+
+    cout << "\033[0;32m[PASSED test_vector_cfr]\033[0m" << endl;
+}
+
+void test_board_chance() {
+    // synthetic buckets, as the data files aren't in the repo
+    DataContainer data;
+    data.flop_buckets.resize(get_hand_indexer(FLOP_SIZE).size());
+    for (ULL i = 0; i < data.flop_buckets.size(); i++) {
+        data.flop_buckets[i] = i % 7;
+    }
+    data.turn_buckets.resize(get_hand_indexer(TURN_SIZE).size());
+    for (ULL i = 0; i < data.turn_buckets.size(); i++) {
+        data.turn_buckets[i] = (i / 3) % 5;
+    }
+    data.turn_clusters.resize(5);
+    data.river_clusters.resize(6);
+    for (auto &cluster : data.river_clusters) {
+        for (int r = 0; r < NUM_RANGES; r++) {
+            cluster[r] = random_unit();
+        }
+    }
+
+    Deck deck;
+    array<int, BOARD_SIZE> board;
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        board[i] = deck.deal();
+    }
+    ULL board_mask = indices_to_mask(board);
+
+    // without swaps the transitions and showdowns count hands exactly
+    array<float, NUM_STREETS-1> no_swaps = {0, 0, 0};
+    BoardChance chance = get_board_chance(board, data, no_swaps);
+    vector<array<int, NUM_STREETS>> buckets;
+    vector<int> strengths;
+    for (int c1 = 0; c1 < 52; c1++) {
+        for (int c2 = c1 + 1; c2 < 52; c2++) {
+            array<int, HAND_SIZE> hand = {c1, c2};
+            if ((indices_to_mask(hand) & board_mask) != 0) {
+                continue;
+            }
+            buckets.push_back(get_cards_info_state(hand, board, data, 0));
+            strengths.push_back(evaluate(indices_to_mask(hand) | board_mask, 7));
+        }
+    }
+    assert(buckets.size() == 1081);
+
+    for (int street = 0; street < NUM_STREETS-1; street++) {
+        vector<double> counts(chance.num_buckets[street] * chance.num_buckets[street+1], 0);
+        vector<double> sizes(chance.num_buckets[street], 0);
+        for (auto &hand_buckets : buckets) {
+            counts[hand_buckets[street] * chance.num_buckets[street+1] + hand_buckets[street+1]]++;
+            sizes[hand_buckets[street]]++;
+        }
+        for (int b = 0; b < chance.num_buckets[street]; b++) {
+            assert(fabs(chance.prior[street][b] - sizes[b] / buckets.size()) < 1e-12);
+            for (int next_b = 0; next_b < chance.num_buckets[street+1]; next_b++) {
+                double expected = sizes[b] == 0 ? 0 : counts[b * chance.num_buckets[street+1] + next_b] / sizes[b];
+                assert(fabs(chance.transition(street, b, next_b) - expected) < 1e-12);
+            }
+        }
+    }
+
+    int river = NUM_STREETS-1;
+    vector<double> scores(chance.num_buckets[river] * chance.num_buckets[river], 0);
+    vector<double> pairs(scores.size(), 0);
+    for (int h1 = 0; h1 < buckets.size(); h1++) {
+        for (int h2 = 0; h2 < buckets.size(); h2++) {
+            int index = buckets[h2][river] * chance.num_buckets[river] + buckets[h1][river];
+            scores[index] += (strengths[h1] > strengths[h2]) - (strengths[h1] < strengths[h2]);
+            pairs[index]++;
+        }
+    }
+    for (int i = 0; i < scores.size(); i++) {
+        double expected = pairs[i] == 0 ? 0 : scores[i] / pairs[i];
+        assert(fabs(chance.showdowns[i] - expected) < 1e-12);
+    }
+
+    // with swaps, each row is still a distribution
+    chance = get_board_chance(board, data, SWAP_ODDS);
+    for (int street = 0; street < NUM_STREETS-1; street++) {
+        for (int b = 0; b < chance.num_buckets[street]; b++) {
+            double total = 0;
+            for (int next_b = 0; next_b < chance.num_buckets[street+1]; next_b++) {
+                assert(chance.transition(street, b, next_b) >= 0);
+                total += chance.transition(street, b, next_b);
+            }
+            assert(chance.prior[street][b] == 0 || fabs(total - 1) < 1e-9);
+        }
+    }
+
+    cout << "\033[0;32m[PASSED test_board_chance]\033[0m" << endl;
+}
+
+// hand evaluation checks
+
+void test_evaluate_flush() {
+    // 2s 4s 6s 8s Ts with a pair of deuces on the side is a flush
+    ULL hand = 0;
+    int cards[7] = {39, 41, 43, 45, 47, 0, 13};
+    for (int i = 0; i < 7; i++) hand |= CARD_MASKS_TABLE[cards[i]];
+
+    assert((unsigned int) evaluate_branching(hand, 7) >= HANDTYPE_VALUE_FLUSH);
+    assert((unsigned int) evaluate_branching(hand, 7) < HANDTYPE_VALUE_FULLHOUSE);
+    assert(evaluate(hand, 7) == evaluate_branching(hand, 7));
+    cout << "\033[0;32m[PASSED test_evaluate_flush]\033[0m" << endl;
+}
+
+// compare both evaluator engines on every 7-card hand
+void test_perfect_hash_evaluator() {
+    ULL count = 0;
+    array<int, 7> c;
+    array<ULL, 8> masks;
+    masks[0] = 0;
+
+    for (c[0] = 0; c[0] < 52; c[0]++) {
+    masks[1] = masks[0] | CARD_MASKS_TABLE[c[0]];
+    for (c[1] = c[0]+1; c[1] < 52; c[1]++) {
+    masks[2] = masks[1] | CARD_MASKS_TABLE[c[1]];
+    for (c[2] = c[1]+1; c[2] < 52; c[2]++) {
+    masks[3] = masks[2] | CARD_MASKS_TABLE[c[2]];
+    for (c[3] = c[2]+1; c[3] < 52; c[3]++) {
+    masks[4] = masks[3] | CARD_MASKS_TABLE[c[3]];
+    for (c[4] = c[3]+1; c[4] < 52; c[4]++) {
+    masks[5] = masks[4] | CARD_MASKS_TABLE[c[4]];
+    for (c[5] = c[4]+1; c[5] < 52; c[5]++) {
+    masks[6] = masks[5] | CARD_MASKS_TABLE[c[5]];
+    for (c[6] = c[5]+1; c[6] < 52; c[6]++) {
+        masks[7] = masks[6] | CARD_MASKS_TABLE[c[6]];
+        assert(evaluate_perfect_hash(masks[7]) == evaluate_branching(masks[7], 7));
+        count++;
+    }}}}}}}
+
+    assert(count == 133784560);
+    cout << "\033[0;32m[PASSED test_perfect_hash_evaluator with "
+        << count << " hands]\033[0m" << endl;
+}
+
+// batched evaluation should agree with one-by-one evaluation,
+// including a ragged tail that doesn't fill a group of 8
+void test_evaluate_batch() {
+    const int n_hands = 1003;
+    array<ULL, n_hands> hands;
+    array<int, n_hands> values;
+
+    for (int i = 0; i < n_hands; i++) {
+        hands[i] = 0;
+        for (int j = 0; j < 7; j++) hands[i] |= deal_card(hands[i]);
+    }
+
+    evaluate_batch(hands.data(), n_hands, values.data());
+    for (int i = 0; i < n_hands; i++) {
+        assert(values[i] == evaluate(hands[i], 7));
+    }
+    cout << "\033[0;32m[PASSED test_evaluate_batch]\033[0m" << endl;
+}
+
+void test_evaluate_with_board() {
+    const int n_boards = 2000;
+
+    for (int i = 0; i < n_boards; i++) {
+        // build the board card by card, as the exact enumeration does
+        ULL board = 0;
+        EvalBoard state = make_eval_board(0);
+        for (int j = 0; j < 5; j++) {
+            ULL card = deal_card(board);
+            board |= card;
+            add_board_cards(state, card);
+        }
+
+        for (int j = 0; j < 20; j++) {
+            ULL hole = deal_card(board);
+            hole |= deal_card(board | hole);
+            assert(evaluate_with_board(state, hole) == evaluate(board | hole, 7));
+        }
+    }
+
+    // exact equity is unchanged from full evaluation
+    ULL hand = CARD_MASKS_TABLE[12] | CARD_MASKS_TABLE[25];
+    ULL villain = CARD_MASKS_TABLE[11] | CARD_MASKS_TABLE[37];
+    ULL board = CARD_MASKS_TABLE[0] | CARD_MASKS_TABLE[5] | CARD_MASKS_TABLE[41];
+    unsigned int count = 0, total = 0;
+    ULL dead = hand | villain | board;
+    for (int i = 0; i < 52; i++) {
+        for (int j = i+1; j < 52; j++) {
+            ULL runout = CARD_MASKS_TABLE[i] | CARD_MASKS_TABLE[j];
+            if ((runout & dead) != 0) continue;
+
+            int hero_value = evaluate(board | runout | hand, 7);
+            int villain_value = evaluate(board | runout | villain, 7);
+            count += (hero_value > villain_value) + (hero_value >= villain_value);
+            total++;
+        }
+    }
+    assert(hand_vs_hand_exact(hand, villain, board, 3) == (float)(0.5 * (double)count / (double)total));
+
+    cout << "\033[0;32m[PASSED test_evaluate_with_board]\033[0m" << endl;
+}
+
+// multi-range equities should match one range at a time
+void test_ranges_equity() {
+    const ULL* ranges[NUM_RANGES];
+    for (int i = 0; i < NUM_RANGES; i++) ranges[i] = RANGES[i];
+    MultiRange multi = make_multi_range(ranges, NUM_RANGE, NUM_RANGES);
+
+    // every listed combo is kept, duplicates included
+    for (int i = 0; i < NUM_RANGES; i++) {
+        assert(multi.range_combos[i].size() == NUM_RANGE[i]);
+    }
+
+    float equities[NUM_RANGES], exact[NUM_RANGES];
+    for (int n = 0; n < 20; n++) {
+        ULL hand = 0, board = 0, villain_dead = 0;
+        for (int j = 0; j < 2; j++) hand |= deal_card(hand);
+        for (int j = 0; j < 5; j++) board |= deal_card(board | hand);
+        villain_dead = deal_card(board | hand);
+
+        // river and turn boards, exactly
+        for (int num_board = 5; num_board >= 4; num_board--) {
+            if (num_board == 4) board &= board - 1;
+
+            hand_vs_ranges_exact(hand, multi, board, num_board, equities, 0, villain_dead);
+            for (int i = 0; i < NUM_RANGES; i++) {
+                assert(equities[i] == hand_vs_range_exact(hand, RANGES[i], NUM_RANGE[i],
+                                                          board, num_board, 0, villain_dead));
+            }
+        }
+
+        // sampled turn equities stay close to exact
+        hand_vs_ranges_exact(hand, multi, board, 4, exact);
+        hand_vs_ranges_monte_carlo(hand, multi, board, 4, 20000, equities);
+        for (int i = 0; i < NUM_RANGES; i++) {
+            assert(abs(equities[i] - exact[i]) < 0.02);
+        }
+
+        // ranges without samples read as an even split, not NaN
+        RangesMonteCarlo sampler(hand, multi, board, 4);
+        sampler.equities(equities);
+        for (int i = 0; i < NUM_RANGES; i++) {
+            assert(equities[i] == 0.5f);
+        }
+    }
+
+    cout << "\033[0;32m[PASSED test_ranges_equity]\033[0m" << endl;
+}
+
+// cached river equities should match exact enumeration for every hand
+void test_river_board_cache() {
+    const ULL* ranges[NUM_RANGES];
+    for (int i = 0; i < NUM_RANGES; i++) ranges[i] = RANGES[i];
+    MultiRange multi = make_multi_range(ranges, NUM_RANGE, NUM_RANGES);
+
+    float cached[NUM_RANGES], exact[NUM_RANGES];
+    for (int n = 0; n < 5; n++) {
+        ULL board = 0;
+        for (int j = 0; j < 5; j++) board |= deal_card(board);
+        RiverBoardCache cache(board, multi);
+
+        for (int i = 0; i < 52; i++) {
+            for (int j = i+1; j < 52; j++) {
+                ULL hand = CARD_MASKS_TABLE[i] | CARD_MASKS_TABLE[j];
+                if ((hand & board) != 0) continue;
+
+                assert(cache.value(hand) == evaluate(board | hand, 7));
+
+                // with and without extra dead cards
+                ULL dead = (n % 2 == 0) ? 0 : deal_card(board | hand) | deal_card(board | hand);
+                cache.equities(hand, cached, dead);
+                hand_vs_ranges_exact(hand, multi, board, 5, exact, dead);
+                for (int r = 0; r < NUM_RANGES; r++) {
+                    assert(cached[r] == exact[r]);
+                }
+            }
+        }
+    }
+
+    cout << "\033[0;32m[PASSED test_river_board_cache]\033[0m" << endl;
+}
+
+// bounded sampling is unbiased and decks deal each live card once
+void test_random_dealing() {
+    const int n_samples = 600000;
+
+    array<int, 6> counts = {0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < n_samples; i++) {
+        unsigned int x = random_below(6);
+        assert(x < 6);
+        counts[x]++;
+    }
+    for (int i = 0; i < 6; i++) {
+        assert(abs(counts[i] - n_samples/6) < 2000); // ~6 standard deviations
+    }
+
+    ULL dead = CARD_MASKS_TABLE[0] | CARD_MASKS_TABLE[17] | CARD_MASKS_TABLE[51];
+    Deck deck(dead);
+    for (int n = 0; n < 3; n++) {
+        ULL dealt = 0;
+        for (int i = 0; i < 49; i++) {
+            ULL card = deck.deal_mask();
+            assert((card & (dealt | dead)) == 0);
+            dealt |= card;
+        }
+        assert(__builtin_popcountll(dealt) == 49);
+        deck.reset();
+    }
+
+    cout << "\033[0;32m[PASSED test_random_dealing]\033[0m" << endl;
+}
+
+// stratified runouts and range walks cover everything once per pass, and
+// adaptive bucketing agrees with exact bucketing on clear-cut hands
+void test_stratified_sampling() {
+    RangeWalk walk(NUM_RANGE[0]);
+    vector<bool> seen(NUM_RANGE[0], false);
+    for (int i = 0; i < NUM_RANGE[0]; i++) {
+        int k = walk.next();
+        assert(!seen[k]);
+        seen[k] = true;
+    }
+
+    ULL dead = 0;
+    for (int j = 0; j < 6; j++) dead |= deal_card(dead);
+    StratifiedDeck deck(dead);
+    for (int n = 0; n < 3; n++) {
+        ULL dealt = 0;
+        for (int i = 0; i < 46; i++) {
+            ULL card = deck.deal_runout(1);
+            assert((card & (dealt | dead)) == 0);
+            dealt |= card;
+        }
+    }
+
+    const ULL* ranges[NUM_RANGES];
+    for (int i = 0; i < NUM_RANGES; i++) ranges[i] = RANGES[i];
+    MultiRange multi = make_multi_range(ranges, NUM_RANGE, NUM_RANGES);
+
+    float exact[NUM_RANGES];
+    for (int n = 0; n < 20; n++) {
+        ULL hand = 0, board = 0;
+        for (int j = 0; j < 2; j++) hand |= deal_card(hand);
+        for (int j = 0; j < 4; j++) board |= deal_card(board | hand);
+
+        float sampled = hand_vs_range_monte_carlo(hand, RANGES[1], NUM_RANGE[1], board, 4, 2000);
+        assert(abs(sampled - hand_vs_range_exact(hand, RANGES[1], NUM_RANGE[1], board, 4)) < 0.03);
+
+        // one cluster on the exact equities, the others well away from it
+        hand_vs_ranges_exact(hand, multi, board, 4, exact);
+        EquityClusters clusters(3);
+        for (int i = 0; i < NUM_RANGES; i++) {
+            clusters[0][i] = exact[i];
+            clusters[1][i] = exact[i] + 0.3;
+            clusters[2][i] = exact[i] - 0.3;
+        }
+        assert(get_bucket_from_clusters(hand, board, 4, clusters, 1000, 0, 0,
+                                        BUCKET_CONFIDENCE_Z) == 0);
+    }
+
+    cout << "\033[0;32m[PASSED test_stratified_sampling]\033[0m" << endl;
+}
+
+// adaptive bucketing stops early on clear-cut hands and reports the work skipped
+void test_adaptive_bucketing() {
+    const ULL* ranges[NUM_RANGES];
+    for (int i = 0; i < NUM_RANGES; i++) ranges[i] = RANGES[i];
+    MultiRange multi = make_multi_range(ranges, NUM_RANGE, NUM_RANGES);
+
+    BucketStats stats;
+    float exact[NUM_RANGES];
+    for (int n = 0; n < 20; n++) {
+        ULL hand = 0, board = 0;
+        for (int j = 0; j < 2; j++) hand |= deal_card(hand);
+        for (int j = 0; j < 4; j++) board |= deal_card(board | hand);
+
+        // nearest cluster on the exact equities, the rest spread well away
+        hand_vs_ranges_exact(hand, multi, board, 4, exact);
+        EquityClusters clusters(20);
+        for (int j = 0; j < clusters.size(); j++) {
+            for (int i = 0; i < NUM_RANGES; i++) {
+                clusters[j][i] = exact[i] + ((j == 0) ? 0 : ((i + j) % 2 ? 0.3 : -0.3));
+            }
+        }
+
+        assert(get_bucket_from_clusters(hand, board, 4, clusters, 10000, 0, 0,
+                                        BUCKET_CONFIDENCE_Z, BUCKET_TOLERANCE,
+                                        &stats) == 0);
+    }
+
+    assert(stats.calls == 20);
+    assert(stats.max_runouts == 20*10000);
+    assert(stats.runouts < stats.max_runouts / 10);
+    assert(stats.evaluations <= stats.runouts*(NUM_RANGES + 1));
+
+    // near locks often win every early sample. Their ranges must stay
+    // uncertain, or the estimate freezes at 1 and a cluster that has those
+    // equities at 1 wins. Find a turn hand with every equity near 0.95
+    ULL hand = 0, board = 0;
+    for (int tries = 0; ; tries++) {
+        assert(tries < 100000);
+        hand = 0;
+        board = 0;
+        for (int j = 0; j < 2; j++) hand |= deal_card(hand);
+        for (int j = 0; j < 4; j++) board |= deal_card(board | hand);
+        hand_vs_ranges_exact(hand, multi, board, 4, exact);
+        if (*min_element(exact, exact + NUM_RANGES) > 0.9 &&
+                *max_element(exact, exact + NUM_RANGES) < 0.99) {
+            break;
+        }
+    }
+    EquityClusters clusters(2);
+    for (int i = 0; i < NUM_RANGES; i++) {
+        clusters[0][i] = exact[i];
+        clusters[1][i] = 1;
+    }
+    for (int n = 0; n < 50; n++) {
+        assert(get_bucket_from_clusters(hand, board, 4, clusters, 10000, 0, 0,
+                                        BUCKET_CONFIDENCE_Z, BUCKET_TOLERANCE) == 0);
+    }
+
+    cout << "\033[0;32m[PASSED test_adaptive_bucketing]\033[0m" << endl;
+}
+
+// isomorphic hands share an index, classes are dense and unindex inverts index
+void test_hand_indexer() {
+    assert(get_hand_indexer(0).size() == 169);
+    assert(get_hand_indexer(3).size() == 1286792);
+    assert(get_hand_indexer(4).size() == 13960050);
+
+    for (int num_board : {0, 3, 4, 5}) {
+        const HandIndexer &indexer = get_hand_indexer(num_board);
+
+        // every index decodes to a valid hand that indexes back to it
+        ULL hole, board;
+        for (ULL i = 0; i < indexer.size(); i += 1 + indexer.size() / 20000) {
+            indexer.unindex(i, hole, board);
+            assert(__builtin_popcountll(hole) == 2);
+            assert(__builtin_popcountll(board) == num_board);
+            assert((hole & board) == 0);
+            assert(indexer.index(hole, board) == i);
+        }
+
+        // permuting suits keeps the index
+        array<int, 4> perm = {0, 1, 2, 3};
+        for (int n = 0; n < 1000; n++) {
+            hole = 0;
+            board = 0;
+            for (int j = 0; j < 2; j++) hole |= deal_card(hole);
+            for (int j = 0; j < num_board; j++) board |= deal_card(board | hole);
+
+            shuffle(perm.begin(), perm.end(), gen);
+            ULL new_hole = 0, new_board = 0;
+            for (int s = 0; s < 4; s++) {
+                new_hole |= ((hole >> (13*s)) & 0x1FFF) << (13*perm[s]);
+                new_board |= ((board >> (13*s)) & 0x1FFF) << (13*perm[s]);
+            }
+            assert(indexer.index(hole, board) == indexer.index(new_hole, new_board));
+        }
+    }
+
+    // preflop classes: pairs, suited and offsuit hands are told apart
+    const HandIndexer &preflop = get_hand_indexer(0);
+    assert(preflop.index(CARD_MASKS_TABLE[12] | CARD_MASKS_TABLE[11], 0) !=
+           preflop.index(CARD_MASKS_TABLE[12] | CARD_MASKS_TABLE[24], 0));
+    assert(preflop.index(CARD_MASKS_TABLE[12] | CARD_MASKS_TABLE[25], 0) !=
+           preflop.index(CARD_MASKS_TABLE[12] | CARD_MASKS_TABLE[24], 0));
+
+    cout << "\033[0;32m[PASSED test_hand_indexer]\033[0m" << endl;
+}
+
+void test_flop_bucket_table() {
+    const HandIndexer &indexer = get_hand_indexer(FLOP_SIZE);
+
+    // dict over every flop class in the legacy key format
+    BucketDict dict;
+    ULL hand, flop;
+    for (ULL i = 0; i < indexer.size(); i++) {
+        indexer.unindex(i, hand, flop);
+        dict[flop_bucket_dict_key(hand, flop)] = i % 251;
+    }
+
+    DataContainer data;
+    assert(flop_bucket_table_from_dict(dict, data.flop_buckets));
+    assert(data.flop_buckets.size() == indexer.size());
+    for (ULL i = 0; i < indexer.size(); i += 97) {
+        assert(data.flop_buckets[i] == i % 251);
+    }
+
+    // random deals look up the bucket of their class
+    for (int n = 0; n < 10000; n++) {
+        Deck deck;
+        array<int, HAND_SIZE> c = {deck.deal(), deck.deal()};
+        array<int, FLOP_SIZE> f = {deck.deal(), deck.deal(), deck.deal()};
+        ULL index = indexer.index(indices_to_mask(c), indices_to_mask(f));
+        assert(get_cards_info_state_flop(c, f, data) == index % 251);
+    }
+
+    // the table file round trips, and headerless files, tables for another
+    // street and missing files are refused
+    const string path = "test_flop_bucket_table.bin";
+    assert(save_bucket_table_to_file(path, data.flop_buckets, FLOP_SIZE));
+    BucketTable loaded;
+    assert(load_bucket_table_from_file(path, loaded, FLOP_SIZE));
+    assert(loaded == data.flop_buckets);
+    assert(!load_bucket_table_from_file(path, loaded, TURN_SIZE) && loaded.empty());
+    {
+        ofstream outfile(path, ios::binary);
+        outfile.write((const char*)data.flop_buckets.data(), data.flop_buckets.size());
+    }
+    assert(!load_bucket_table_from_file(path, loaded, FLOP_SIZE) && loaded.empty());
+    remove(path.c_str());
+    assert(!load_bucket_table_from_file(path, loaded, FLOP_SIZE) && loaded.empty());
+
+    // a dict missing any class fails instead of filling bucket 0
+    dict.erase(dict.begin());
+    assert(!flop_bucket_table_from_dict(dict, loaded) && loaded.empty());
+
+    cout << "\033[0;32m[PASSED test_flop_bucket_table]\033[0m" << endl;
+}
+
 // checks specific to swap hold 'em
 
 void test_deal_swaps() {
@@ -355,6 +1931,36 @@ int main() {
     test_unique_action_keys();
     test_history_traversal();
     test_infoset_purification();
+    test_mapped_infosets();
+    test_infoset_table();
+    test_infoset_table_concurrent();
+    test_regret_storage();
+    test_update_rules();
+    test_merge_infosets();
+    test_flat_game_tree();
+    test_traversal_allocations();
+    test_batch_queue();
+    test_affinity();
+    test_dense_infoset_table();
+    test_checkpoint();
+    test_fast_load();
+    test_vector_cfr();
+
+    // hand evaluation
+    test_evaluate_flush();
+#ifdef EVAL7PP_PERFECT_HASH
+    test_perfect_hash_evaluator(); // the tables are only built then
+#endif
+    test_evaluate_batch();
+    test_evaluate_with_board();
+    test_ranges_equity();
+    test_river_board_cache();
+    test_random_dealing();
+    test_stratified_sampling();
+    test_adaptive_bucketing();
+    test_hand_indexer();
+    test_flop_bucket_table();
+    test_board_chance();
 
     // visual checks
     check_card_dist();
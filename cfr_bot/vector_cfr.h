@@ -0,0 +1,233 @@
+#ifndef REAL_POKER_VECTOR_CFR
+#define REAL_POKER_VECTOR_CFR
+
+#include "gametree.h"
+
+using namespace std;
+
+// public chance sampling (vector) CFR: only the board is sampled, and each
+// traversal carries both players' reach over all their buckets (card infos)
+// through the tree, so one walk of the betting tree trains every bucket of
+// the acting player at once. The work per node is loops over bucket vectors
+// (regret matching per bucket, matrix-vector products at street changes and
+// showdowns) instead of one infoset per node as in multi_mccfr
+
+// most card infos on a street (the preflop hand classes)
+const int MAX_BUCKETS = NUM_RANKS*NUM_RANKS;
+
+// one value per bucket of a street, on the stack so a traversal doesn't
+// allocate
+using BucketValues = array<double, MAX_BUCKETS>;
+
+// chance on one board, over the buckets of each street. A player's bucket is
+// treated as their private state: they start in preflop bucket b with
+// probability prior[0][b], move between streets' buckets (swaps included)
+// with the transition probabilities, and at showdown river bucket b scores
+// showdown(b_opp, b) against the opponent's b_opp on average (1 for a sure
+// win, -1 for a sure loss). Hands within a bucket are averaged over and card
+// removal between the two players' hands is ignored
+struct BoardChance {
+    array<int, NUM_STREETS> num_buckets = {};
+    array<BucketValues, NUM_STREETS> prior; // P(bucket) on each street
+
+    // [street]: num_buckets[street] x num_buckets[street+1], row b holds the
+    // next street's bucket distribution from bucket b
+    array<vector<double>, NUM_STREETS-1> transitions;
+    // num_buckets[river] x num_buckets[river], opponent bucket major
+    vector<double> showdowns;
+
+    BoardChance() {}
+    explicit BoardChance(const array<int, NUM_STREETS> &init_num_buckets)
+        : num_buckets(init_num_buckets) {
+        for (int street = 0; street < NUM_STREETS; street++) {
+            assert(num_buckets[street] <= MAX_BUCKETS);
+            prior[street].fill(0);
+        }
+        for (int street = 0; street < NUM_STREETS-1; street++) {
+            transitions[street].assign(num_buckets[street] * num_buckets[street+1], 0);
+        }
+        showdowns.assign(num_buckets[NUM_STREETS-1] * num_buckets[NUM_STREETS-1], 0);
+    }
+
+    double& transition(int street, int bucket, int next_bucket) {
+        return transitions[street][bucket * num_buckets[street+1] + next_bucket];
+    }
+    double& showdown(int opp_bucket, int bucket) {
+        return showdowns[opp_bucket * num_buckets[NUM_STREETS-1] + bucket];
+    }
+};
+
+// chance for a dealt board, from every hand that doesn't use its cards:
+// their buckets on each street (data must have turn_buckets), swaps before
+// each street with swap_odds per card, and river hand strengths
+BoardChance get_board_chance(const array<int, BOARD_SIZE> &board, const DataContainer &data,
+                             const array<float, NUM_STREETS-1> &swap_odds);
+
+// reach over a street's buckets carried into the next street's
+inline void advance_reach(const BoardChance &chance, int street,
+                          const BucketValues &reach, BucketValues &next_reach) {
+    int n = chance.num_buckets[street], next_n = chance.num_buckets[street+1];
+    fill(next_reach.begin(), next_reach.begin() + next_n, 0.);
+    for (int b = 0; b < n; b++) {
+        if (reach[b] == 0) {
+            continue;
+        }
+        const double *row = &chance.transitions[street][b * next_n];
+        for (int next_b = 0; next_b < next_n; next_b++) {
+            next_reach[next_b] += reach[b] * row[next_b];
+        }
+    }
+}
+
+// values over the next street's buckets as expected values over the street's
+inline void retract_values(const BoardChance &chance, int street,
+                           const BucketValues &next_values, BucketValues &values) {
+    int n = chance.num_buckets[street], next_n = chance.num_buckets[street+1];
+    for (int b = 0; b < n; b++) {
+        const double *row = &chance.transitions[street][b * next_n];
+        double value = 0;
+        for (int next_b = 0; next_b < next_n; next_b++) {
+            value += row[next_b] * next_values[next_b];
+        }
+        values[b] = value;
+    }
+}
+
+// one traversal for the player in seat 0: values[b] is their expected
+// utility in bucket b at node (given the bucket), weighted by the opponent's
+// reach reach1 (which includes chance). reach0 and reach1 are over the
+// buckets of street, the street of node's parent: chance moves both to
+// node's street first. Seat 0's infosets at node are recorded for every
+// bucket the board allows, with regrets weighted by the bucket's probability
+// and strategy by reach0
+inline void vector_cfr(const FlatGameTree &tree, const FlatGameNode &node, int street,
+                       const BoardChance &chance,
+                       const BucketValues &reach0, const BucketValues &reach1,
+                       DenseInfosetTable &infosets, BucketValues &values,
+                       const CFRUpdateRule &rule = CFRUpdateRule()) {
+
+    // showdowns (street past the river) are decided by river buckets
+    int node_street = min((int) node.street, NUM_STREETS-1);
+    if (street < node_street) {
+        BucketValues next_reach0, next_reach1, next_values;
+        advance_reach(chance, street, reach0, next_reach0);
+        advance_reach(chance, street, reach1, next_reach1);
+        vector_cfr(tree, node, street+1, chance, next_reach0, next_reach1,
+                   infosets, next_values, rule);
+        retract_values(chance, street, next_values, values);
+        return;
+    }
+
+    int n = chance.num_buckets[street];
+
+    // reached leaf node
+    if (node.num_children == 0) {
+        if (!node.showdown) {
+            double opp_reach = 0;
+            for (int b = 0; b < n; b++) {
+                opp_reach += reach1[b];
+            }
+            fill(values.begin(), values.begin() + n, node.won * opp_reach);
+        }
+        else {
+            fill(values.begin(), values.begin() + n, 0.);
+            for (int opp_b = 0; opp_b < n; opp_b++) {
+                if (reach1[opp_b] == 0) {
+                    continue;
+                }
+                const double *row = &chance.showdowns[opp_b * n];
+                double weight = node.won * reach1[opp_b];
+                for (int b = 0; b < n; b++) {
+                    values[b] += weight * row[b];
+                }
+            }
+        }
+        return;
+    }
+
+    // neither player gets here on this board
+    bool reached = false;
+    for (int b = 0; b < n && !reached; b++) {
+        reached = reach0[b] != 0 || reach1[b] != 0;
+    }
+    if (!reached) {
+        fill(values.begin(), values.begin() + n, 0.);
+        return;
+    }
+
+    // the opponent's strategy only matters where they can be
+    const BucketValues &actor_reach = (node.ind == 0) ? chance.prior[street] : reach1;
+    array<ActionValues, MAX_BUCKETS> strategies;
+    for (int b = 0; b < n; b++) {
+        if (actor_reach[b] != 0) {
+            infosets.at(node, b).get_regret_matching_strategy(strategies[b].data());
+        }
+        else {
+            fill(strategies[b].begin(), strategies[b].begin() + node.num_children, 0.);
+        }
+    }
+    BucketValues child_reach;
+
+    // traverser's action: values of every action, then regrets
+    if (node.ind == 0) {
+        array<BucketValues, MAX_ACTIONS> action_values;
+        for (int i = 0; i < node.num_children; i++) {
+            for (int b = 0; b < n; b++) {
+                child_reach[b] = reach0[b] * strategies[b][i];
+            }
+            vector_cfr(tree, tree.child(node, i), street, chance, child_reach, reach1,
+                       infosets, action_values[i], rule);
+        }
+
+        ActionValues regrets, strategy_weights;
+        for (int b = 0; b < n; b++) {
+            values[b] = 0;
+            for (int i = 0; i < node.num_children; i++) {
+                values[b] += strategies[b][i] * action_values[i][b];
+            }
+
+            double bucket_prob = chance.prior[street][b];
+            if (bucket_prob == 0) { // no hand in this bucket on this board
+                continue;
+            }
+            for (int i = 0; i < node.num_children; i++) {
+                regrets[i] = bucket_prob * (action_values[i][b] - values[b]);
+                strategy_weights[i] = reach0[b] * strategies[b][i];
+            }
+            infosets.at(node, b).record(regrets.data(), strategy_weights.data(), rule);
+        }
+    }
+    // villain's action: every action, weighted in its reach
+    else {
+        fill(values.begin(), values.begin() + n, 0.);
+        BucketValues child_values;
+        for (int i = 0; i < node.num_children; i++) {
+            for (int b = 0; b < n; b++) {
+                child_reach[b] = reach1[b] * strategies[b][i];
+            }
+            vector_cfr(tree, tree.child(node, i), street, chance, reach0, child_reach,
+                       infosets, child_values, rule);
+            for (int b = 0; b < n; b++) {
+                values[b] += child_values[b];
+            }
+        }
+    }
+}
+
+// one iteration on a board: seat 0 of tree (so the player on tree's button
+// position) is traversed from the root. Returns their expected value
+inline double vector_cfr_top(const FlatGameTree &tree, const BoardChance &chance,
+                             DenseInfosetTable &infosets,
+                             const CFRUpdateRule &rule = CFRUpdateRule()) {
+    BucketValues values;
+    vector_cfr(tree, tree.root(), 0, chance, chance.prior[0], chance.prior[0],
+               infosets, values, rule);
+
+    double value = 0;
+    for (int b = 0; b < chance.num_buckets[0]; b++) {
+        value += chance.prior[0][b] * values[b];
+    }
+    return value;
+}
+
+#endif
@@ -7,4 +7,8 @@ extern unsigned int TOP_FIVE_CARDS_TABLE[8192];
 extern unsigned short TOP_CARD_TABLE[8192];
 extern unsigned long long CARD_MASKS_TABLE[52];
 
+// row displacements for the perfect-hash evaluator (see compute_rank_hash_offsets)
+const int RANK_HASH_NUM_ROWS = 1911;
+extern unsigned int RANK_HASH_OFFSETS[RANK_HASH_NUM_ROWS];
+
 #endif
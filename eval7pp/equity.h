@@ -5,17 +5,19 @@
 #include <iostream>
 #include <random>
 #include <array>
+#include <algorithm>
+#include <vector>
 
 #include "evaluate.h"
+#include "random.h"
 
 using namespace std;
 
-extern thread_local random_device rd;
-extern thread_local mt19937 gen;
-// minstd_rand gen(rd()); // should be much faster than Mersenne, at the cost of quality
+// number of showdowns dealt before handing them to evaluate_batch
+const int EVAL_BATCH_SIZE = 64;
 
 inline int sample_card_dist() {
-    return gen() % 52;
+    return random_below(52);
 }
 
 inline int sample_card_dist(unsigned long long dead) {
@@ -180,4 +182,123 @@ inline float hand_vs_range_exact(unsigned long long hand,
     return hand_vs_range_exact(hand, villain_range, num_villain_range, start_board, __builtin_popcountll(start_board)); // needs gcc
 }
 
+//////// multi-range equity ////////
+
+// per-range tallies are kept in fixed-size arrays
+const int MAX_MULTI_RANGES = 32;
+
+// several villain ranges stored as the union of their combos, so one runout
+// scores a combo shared by several ranges only once. Combos are grouped by how
+// often each range lists them, so tallies are spread per group, not per combo
+struct MultiRange {
+    int num_ranges = 0;
+    vector<unsigned long long> combos;
+    vector<int> group_starts; // group g = combos[group_starts[g], group_starts[g+1])
+    vector<int> group_weights; // [g*num_ranges + r] = times range r lists each combo of g
+    vector<vector<int>> range_combos; // range r as indices into combos (in listed order)
+};
+
+MultiRange make_multi_range(const unsigned long long* const ranges[],
+                            const int num_range[], int num_ranges);
+
+// hero's exact equity against every range at once: each runout evaluates
+// hero once and each live combo once, tallying into all ranges containing it
+void hand_vs_ranges_exact(
+    unsigned long long hand,
+    const MultiRange& multi,
+    unsigned long long start_board,
+    int num_board,
+    float equities[],
+    unsigned long long common_dead = 0,
+    unsigned long long villain_dead = 0);
+
+// resumable Monte Carlo against several ranges: sample() can be called
+// repeatedly and the running estimates read in between (e.g. to stop once
+// they are precise enough). Each runout evaluates hero once and one villain
+// combo per range. Runouts are stratified on their first card and each range
+// is walked with a RangeWalk. A combo that collides with the runout drops
+// that range's sample, keeping the estimate unbiased. Ranges marked inactive
+// are skipped, freezing their estimates
+struct RangesMonteCarlo {
+    const MultiRange& multi;
+    unsigned long long hand;
+    unsigned long long start_board;
+    int num_board;
+    unsigned long long static_dead; // cards no villain combo can hold
+
+    StratifiedDeck deck;
+    vector<RangeWalk> walks;
+
+    // per range: whether it is still sampled, sum of scores (2 = win,
+    // 1 = tie), sum of squared scores, samples
+    bool active[MAX_MULTI_RANGES];
+    unsigned int count[MAX_MULTI_RANGES];
+    unsigned int square[MAX_MULTI_RANGES];
+    unsigned int total[MAX_MULTI_RANGES];
+    int iterations; // runouts dealt so far
+    long long evaluations; // hands evaluated so far (hero and villains)
+
+    RangesMonteCarlo(unsigned long long hand,
+                     const MultiRange& multi,
+                     unsigned long long start_board,
+                     int num_board,
+                     unsigned long long common_dead = 0,
+                     unsigned long long villain_dead = 0);
+
+    void sample(int num_samples);
+
+    // equity against each range so far (0.5 for ranges with no samples)
+    void equities(float equities[]) const;
+
+    // variance of each equity estimate, treating samples as independent
+    // (stratification only makes the true variance smaller), floored so
+    // ranges that won or lost every sample so far stay uncertain
+    void variances(float variances[]) const;
+};
+
+// all samples in one go with RangesMonteCarlo
+void hand_vs_ranges_monte_carlo(
+    unsigned long long hand,
+    const MultiRange& multi,
+    unsigned long long start_board,
+    int num_board,
+    int iterations,
+    float equities[],
+    unsigned long long common_dead = 0,
+    unsigned long long villain_dead = 0);
+
+// all 2-card holdings on one complete (5-card) board: each live combo is
+// evaluated once and ranked by strength, and per-range weights are prefix
+// summed over strength, so hand-vs-range equity is a lookup plus a correction
+// for the combos hero (or other dead cards) block
+struct RiverBoardCache {
+    unsigned long long board;
+    int num_ranges;
+    int num_strengths; // distinct hand values among live combos
+
+    // indexed by combo_index(): hand value and dense strength rank
+    // (ascending), or -1 for combos that collide with the board
+    vector<int> values;
+    vector<int> strengths;
+
+    vector<int> weights; // [combo_index*num_ranges + r] = times range r lists the combo
+    vector<int> below; // [r*(num_strengths+1) + k] = weight of range r with strength < k
+
+    RiverBoardCache(unsigned long long board, const MultiRange& multi);
+
+    static int combo_index(unsigned long long hole) {
+        return 52*__builtin_ctzll(hole) + (63 - __builtin_clzll(hole));
+    }
+
+    // equal to evaluate(board | hole, 7)
+    int value(unsigned long long hole) const {
+        return values[combo_index(hole)];
+    }
+
+    // same result as hand_vs_ranges_exact on this board, with dead = common
+    // and villain dead cards together
+    void equities(unsigned long long hand, float equities[],
+                  unsigned long long dead = 0) const;
+};
+
 #endif
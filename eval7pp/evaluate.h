@@ -1,6 +1,8 @@
 #ifndef EVAL7PP_EVALUATE
 #define EVAL7PP_EVALUATE
 
+#include <vector>
+
 #include "arrays.h"
 
 extern int CLUB_OFFSET;
@@ -27,10 +29,83 @@ extern unsigned int HANDTYPE_VALUE_TWOPAIR;
 extern unsigned int HANDTYPE_VALUE_PAIR;
 extern unsigned int HANDTYPE_VALUE_HIGHCARD;
 
+//////// perfect-hash tables (built in evaluate.cpp, with EVAL7PP_PERFECT_HASH) ////////
+
+// additive rank keys: the sum of keys over any 7 ranks (with at most four of
+// each rank) is unique, so the key of a non-flush hand identifies its rank
+// multiset and hence its value
+const unsigned int RANK_KEYS[13] = {
+    0, 1, 5, 22, 98, 453, 2031, 8698, 22854, 83661, 262349, 636345, 1479181
+};
+
+// rank keys are compressed into a dense table by row displacement:
+// index = RANK_HASH_OFFSETS[key >> RANK_HASH_ROW_SHIFT] + (key & RANK_HASH_ROW_MASK)
+const int RANK_HASH_ROW_SHIFT = 12;
+const unsigned int RANK_HASH_ROW_MASK = (1U << RANK_HASH_ROW_SHIFT) - 1;
+
+extern unsigned int FLUSH_TABLE[8192];
+extern std::vector<unsigned int> RANK_HASH_TABLE;
+
+// hand value for 0-7 cards (higher is better). Dispatches to the perfect-hash
+// engine for 7-card hands when built with EVAL7PP_PERFECT_HASH
 int evaluate(unsigned long long cards, unsigned int num_cards);
 
+// table-free evaluator (port of eval7), valid for any number of cards
+int evaluate_branching(unsigned long long cards, unsigned int num_cards);
+
+// 7-card evaluator: a flush-table lookup or a rank-key lookup into a
+// perfect hash of all non-flush rank multisets (exactly 7 cards only, and
+// only in EVAL7PP_PERFECT_HASH builds, which build the tables)
+int evaluate_perfect_hash(unsigned long long cards);
+
+// evaluate n 7-card hands into out[0..n). Uses an AVX2 kernel over groups of
+// 8 hands when available (perfect-hash builds only), else evaluates one by one
+void evaluate_batch(const unsigned long long* cards, int n, int* out);
+
+// 5 shared board cards of an exact enumeration. The board's rank key and suit
+// masks are accumulated once per runout (card by card as the runout is
+// dealt), so scoring a 2-card holding only adds its two card rank keys.
+// Without EVAL7PP_PERFECT_HASH only the cards are kept, and holdings are
+// scored by evaluate
+struct EvalBoard {
+    unsigned long long cards;
+    unsigned int key;
+    unsigned int suit_masks[4];
+    int flush_suit; // suit with 3+ board cards (at most one), or -1
+    int flush_offset; // bit offset of flush_suit
+};
+
+// board state for the given cards (may be empty and extended later)
+EvalBoard make_eval_board(unsigned long long board);
+void add_board_cards(EvalBoard& board, unsigned long long cards);
+
+// offline search for the RANK_HASH_OFFSETS row displacements in arrays.cpp
+void compute_rank_hash_offsets(unsigned int offsets[]);
+
 inline int evaluate(unsigned long long cards) {
     return evaluate(cards, __builtin_popcountll(cards)); // needs gcc
 }
 
+// value of 5 board cards plus a 2-card holding; equal to evaluate(board | hole, 7)
+inline int evaluate_with_board(const EvalBoard& board, unsigned long long hole) {
+#ifndef EVAL7PP_PERFECT_HASH
+    return evaluate(board.cards | hole, 7);
+#else
+    // only the suit already holding 3+ board cards can complete a flush
+    if (board.flush_suit >= 0) {
+        unsigned int suited = board.suit_masks[board.flush_suit]
+            | (unsigned int)((hole >> board.flush_offset) & 0x1fffUL);
+        if (N_BITS_TABLE[suited] >= 5) {
+            return FLUSH_TABLE[suited];
+        }
+    }
+
+    // card i has rank i % 13 (suits are 13 bits apart)
+    unsigned int key = board.key
+        + RANK_KEYS[__builtin_ctzll(hole) % 13] + RANK_KEYS[(63 - __builtin_clzll(hole)) % 13];
+    return RANK_HASH_TABLE[RANK_HASH_OFFSETS[key >> RANK_HASH_ROW_SHIFT]
+                            + (key & RANK_HASH_ROW_MASK)];
+#endif
+}
+
 #endif
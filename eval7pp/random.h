@@ -0,0 +1,221 @@
+#ifndef EVAL7PP_RANDOM
+#define EVAL7PP_RANDOM
+
+#include <random>
+#include <algorithm>
+#include <cstdint>
+
+#include "arrays.h"
+
+using namespace std;
+
+// xoshiro256** (Blackman & Vigna): 256 bits of state, a few adds, shifts and
+// rotates per 64-bit output. Satisfies UniformRandomBitGenerator so it also
+// works with the <random> distributions
+struct Xoshiro256 {
+    using result_type = uint64_t;
+
+    uint64_t s[4];
+
+    explicit Xoshiro256(uint64_t seed_value = 0x9e3779b97f4a7c15ULL) {
+        seed(seed_value);
+    }
+
+    // expand a 64-bit seed into the full state with splitmix64
+    void seed(uint64_t seed_value) {
+        for (int i = 0; i < 4; i++) {
+            seed_value += 0x9e3779b97f4a7c15ULL;
+            uint64_t z = seed_value;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            s[i] = z ^ (z >> 31);
+        }
+    }
+
+    static constexpr uint64_t min() { return 0; }
+    static constexpr uint64_t max() { return UINT64_MAX; }
+
+    static inline uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    inline uint64_t operator()() {
+        uint64_t result = rotl(s[1] * 5, 7) * 9;
+        uint64_t t = s[1] << 17;
+
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+
+        return result;
+    }
+};
+
+// RNG used for dealing and sampling. Build with EVAL7PP_MT19937 to go back to
+// the Mersenne Twister (e.g. to compare results)
+#ifdef EVAL7PP_MT19937
+using FastRNG = mt19937_64;
+#else
+using FastRNG = Xoshiro256;
+#endif
+
+// one generator per thread, so producer/worker threads never share state
+extern thread_local FastRNG gen;
+
+// 64 bits from the OS entropy source, for seeding
+inline uint64_t random_seed() {
+    random_device rd;
+    return ((uint64_t)rd() << 32) ^ rd();
+}
+
+// uniform integer in [0, n) without modulo bias (Lemire's multiply-shift,
+// rejecting the few low products that would over-represent some values)
+inline unsigned int random_below(unsigned int n) {
+    uint64_t m = (uint64_t)(uint32_t)(gen() >> 32) * n;
+    uint32_t low = (uint32_t)m;
+    if (low < n) {
+        uint32_t threshold = (uint32_t)(-n) % n;
+        while (low < threshold) {
+            m = (uint64_t)(uint32_t)(gen() >> 32) * n;
+            low = (uint32_t)m;
+        }
+    }
+    return m >> 32;
+}
+
+// uniform double in [0, 1) from the top 53 bits
+inline double random_unit() {
+    return (gen() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// cards not in a dead mask, dealt without replacement by partial
+// Fisher-Yates: each deal swaps a random undealt card to the end of the
+// undealt region. The array always holds the same cards, so reset() makes
+// the whole deck available again without rebuilding it
+struct Deck {
+    int cards[52];
+    int num_cards; // cards in the deck
+    int num_left; // cards not yet dealt
+
+    explicit Deck(unsigned long long dead = 0) : num_cards(0) {
+        for (int i = 0; i < 52; i++) {
+            if ((CARD_MASKS_TABLE[i] & dead) == 0) {
+                cards[num_cards] = i;
+                num_cards++;
+            }
+        }
+        num_left = num_cards;
+    }
+
+    inline void reset() {
+        num_left = num_cards;
+    }
+
+    inline int deal() {
+        int i = random_below(num_left);
+        num_left--;
+        swap(cards[i], cards[num_left]);
+        return cards[num_left];
+    }
+
+    inline unsigned long long deal_mask() {
+        return CARD_MASKS_TABLE[deal()];
+    }
+
+    // deal a card not in dead (cards skipped this way are still dealt)
+    inline unsigned long long deal_mask(unsigned long long dead) {
+        unsigned long long card = deal_mask();
+        while ((card & dead) != 0) {
+            card = deal_mask();
+        }
+        return card;
+    }
+};
+
+// first runout card for stratified sampling: walks the deck in a shuffled
+// order, reshuffling after each pass, so every card leads a runout equally
+// often (for a one-card runout this is sampling without replacement)
+struct StratifiedDeck {
+    Deck deck;
+    int order[52];
+    int next;
+
+    explicit StratifiedDeck(unsigned long long dead = 0) : deck(dead) {
+        copy(deck.cards, deck.cards + deck.num_cards, order);
+        next = deck.num_cards;
+    }
+
+    inline int lead() {
+        if (next >= deck.num_cards) {
+            shuffle(order, order + deck.num_cards, gen);
+            next = 0;
+        }
+        int card = order[next];
+        next++;
+        return card;
+    }
+
+    // num_cards runout cards avoiding dead: the stratified lead card, then
+    // the rest dealt at random from the deck
+    inline unsigned long long deal_runout(int num_cards,
+                                          unsigned long long dead = 0) {
+        if (num_cards == 0) {
+            return 0;
+        }
+
+        unsigned long long runout = CARD_MASKS_TABLE[lead()];
+        while ((runout & dead) != 0) {
+            runout = CARD_MASKS_TABLE[lead()];
+        }
+
+        deck.reset();
+        for (int i = 1; i < num_cards; i++) {
+            runout |= deck.deal_mask(runout | dead);
+        }
+        return runout;
+    }
+};
+
+// visits 0..n-1 from a random start with a stride near n/phi that is coprime
+// to n, so each index comes up once per n steps and any run of steps is
+// spread over the whole range rather than one end of it (ranges are listed
+// in a structured order)
+struct RangeWalk {
+    int n;
+    int index;
+    int stride;
+
+    explicit RangeWalk(int n) : n(n), index(0), stride(1) {
+        if (n <= 1) {
+            return;
+        }
+        index = random_below(n);
+        stride = max(1, (int)(n * 0.6180339887));
+        while (gcd(stride, n) != 1) {
+            stride++;
+        }
+    }
+
+    static int gcd(int a, int b) {
+        while (b != 0) {
+            int t = a % b;
+            a = b;
+            b = t;
+        }
+        return a;
+    }
+
+    inline int next() {
+        int i = index;
+        index += stride;
+        if (index >= n) {
+            index -= n;
+        }
+        return i;
+    }
+};
+
+#endif
@@ -5,3 +5,4 @@ unsigned short STRAIGHT_TABLE[8192] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 unsigned int TOP_FIVE_CARDS_TABLE[8192] = {0, 0, 65536, 65536, 131072, 131072, 135168, 135168, 196608, 196608, 200704, 200704, 204800, 204800, 205056, 205056, 262144, 262144, 266240, 266240, 270336, 270336, 270592, 270592, 274432, 274432, 274688, 274688, 274944, 274944, 274960, 274960, 327680, 327680, 331776, 331776, 335872, 335872, 336128, 336128, 339968, 339968, 340224, 340224, 340480, 340480, 340496, 340496, 344064, 344064, 344320, 344320, 344576, 344576, 344592, 344592, 344832, 344832, 344848, 344848, 344864, 344864, 344865, 344865, 393216, 393216, 397312, 397312, 401408, 401408, 401664, 401664, 405504, 405504, 405760, 405760, 406016, 406016, 406032, 406032, 409600, 409600, 409856, 409856, 410112, 410112, 410128, 410128, 410368, 410368, 410384, 410384, 410400, 410400, 410401, 410401, 413696, 413696, 413952, 413952, 414208, 414208, 414224, 414224, 414464, 414464, 414480, 414480, 414496, 414496, 414497, 414497, 414720, 414720, 414736, 414736, 414752, 414752, 414753, 414753, 414768, 414768, 414769, 414769, 414770, 414770, 414770, 414770, 458752, 458752, 462848, 462848, 466944, 466944, 467200, 467200, 471040, 471040, 471296, 471296, 471552, 471552, 471568, 471568, 475136, 475136, 475392, 475392, 475648, 475648, 475664, 475664, 475904, 475904, 475920, 475920, 475936, 475936, 475937, 475937, 479232, 479232, 479488, 479488, 479744, 479744, 479760, 479760, 480000, 480000, 480016, 480016, 480032, 480032, 480033, 480033, 480256, 480256, 480272, 480272, 480288, 480288, 480289, 480289, 480304, 480304, 480305, 480305, 480306, 480306, 480306, 480306, 483328, 483328, 483584, 483584, 483840, 483840, 483856, 483856, 484096, 484096, 484112, 484112, 484128, 484128, 484129, 484129, 484352, 484352, 484368, 484368, 484384, 484384, 484385, 484385, 484400, 484400, 484401, 484401, 484402, 484402, 484402, 484402, 484608, 484608, 484624, 484624, 484640, 484640, 484641, 484641, 484656, 484656, 484657, 484657, 484658, 484658, 484658, 484658, 484672, 484672, 484673, 484673, 484674, 484674, 484674, 484674, 484675, 484675, 484675, 484675, 484675, 484675, 484675, 484675, 524288, 524288, 528384, 528384, 532480, 532480, 532736, 532736, 536576, 536576, 536832, 536832, 537088, 537088, 537104, 537104, 540672, 540672, 540928, 540928, 541184, 541184, 541200, 541200, 541440, 541440, 541456, 541456, 541472, 541472, 541473, 541473, 544768, 544768, 545024, 545024, 545280, 545280, 545296, 545296, 545536, 545536, 545552, 545552, 545568, 545568, 545569, 545569, 545792, 545792, 545808, 545808, 545824, 545824, 545825, 545825, 545840, 545840, 545841, 545841, 545842, 545842, 545842, 545842, 548864, 548864, 549120, 549120, 549376, 549376, 549392, 549392, 549632, 549632, 549648, 549648, 549664, 549664, 549665, 549665, 549888, 549888, 549904, 549904, 549920, 549920, 549921, 549921, 549936, 549936, 549937, 549937, 549938, 549938, 549938, 549938, 550144, 550144, 550160, 550160, 550176, 550176, 550177, 550177, 550192, 550192, 550193, 550193, 550194, 550194, 550194, 550194, 550208, 550208, 550209, 550209, 550210, 550210, 550210, 550210, 550211, 550211, 550211, 550211, 550211, 550211, 550211, 550211, 552960, 552960, 553216, 553216, 553472, 553472, 553488, 553488, 553728, 553728, 553744, 553744, 553760, 553760, 553761, 553761, 553984, 553984, 554000, 554000, 554016, 554016, 554017, 554017, 554032, 554032, 554033, 554033, 554034, 554034, 554034, 554034, 554240, 554240, 554256, 554256, 554272, 554272, 554273, 554273, 554288, 554288, 554289, 554289, 554290, 554290, 554290, 554290, 554304, 554304, 554305, 554305, 554306, 554306, 554306, 554306, 554307, 554307, 554307, 554307, 554307, 554307, 554307, 554307, 554496, 554496, 554512, 554512, 554528, 554528, 554529, 554529, 554544, 554544, 554545, 554545, 554546, 554546, 554546, 554546, 554560, 554560, 554561, 554561, 554562, 554562, 554562, 554562, 554563, 554563, 554563, 554563, 554563, 554563, 554563, 554563, 554576, 554576, 554577, 554577, 554578, 554578, 554578, 554578, 554579, 554579, 554579, 554579, 554579, 554579, 554579, 554579, 554580, 554580, 554580, 554580, 554580, 554580, 554580, 554580, 554580, 554580, 554580, 554580, 554580, 554580, 554580, 554580, 589824, 589824, 593920, 593920, 598016, 598016, 598272, 598272, 602112, 602112, 602368, 602368, 602624, 602624, 602640, 602640, 606208, 606208, 606464, 606464, 606720, 606720, 606736, 606736, 606976, 606976, 606992, 606992, 607008, 607008, 607009, 607009, 610304, 610304, 610560, 610560, 610816, 610816, 610832, 610832, 611072, 611072, 611088, 611088, 611104, 611104, 611105, 611105, 611328, 611328, 611344, 611344, 611360, 611360, 611361, 611361, 611376, 611376, 611377, 611377, 611378, 611378, 611378, 611378, 614400, 614400, 614656, 614656, 614912, 614912, 614928, 614928, 615168, 615168, 615184, 615184, 615200, 615200, 615201, 615201, 615424, 615424, 615440, 615440, 615456, 615456, 615457, 615457, 615472, 615472, 615473, 615473, 615474, 615474, 615474, 615474, 615680, 615680, 615696, 615696, 615712, 615712, 615713, 615713, 615728, 615728, 615729, 615729, 615730, 615730, 615730, 615730, 615744, 615744, 615745, 615745, 615746, 615746, 615746, 615746, 615747, 615747, 615747, 615747, 615747, 615747, 615747, 615747, 618496, 618496, 618752, 618752, 619008, 619008, 619024, 619024, 619264, 619264, 619280, 619280, 619296, 619296, 619297, 619297, 619520, 619520, 619536, 619536, 619552, 619552, 619553, 619553, 619568, 619568, 619569, 619569, 619570, 619570, 619570, 619570, 619776, 619776, 619792, 619792, 619808, 619808, 619809, 619809, 619824, 619824, 619825, 619825, 619826, 619826, 619826, 619826, 619840, 619840, 619841, 619841, 619842, 619842, 619842, 619842, 619843, 619843, 619843, 619843, 619843, 619843, 619843, 619843, 620032, 620032, 620048, 620048, 620064, 620064, 620065, 620065, 620080, 620080, 620081, 620081, 620082, 620082, 620082, 620082, 620096, 620096, 620097, 620097, 620098, 620098, 620098, 620098, 620099, 620099, 620099, 620099, 620099, 620099, 620099, 620099, 620112, 620112, 620113, 620113, 620114, 620114, 620114, 620114, 620115, 620115, 620115, 620115, 620115, 620115, 620115, 620115, 620116, 620116, 620116, 620116, 620116, 620116, 620116, 620116, 620116, 620116, 620116, 620116, 620116, 620116, 620116, 620116, 622592, 622592, 622848, 622848, 623104, 623104, 623120, 623120, 623360, 623360, 623376, 623376, 623392, 623392, 623393, 623393, 623616, 623616, 623632, 623632, 623648, 623648, 623649, 623649, 623664, 623664, 623665, 623665, 623666, 623666, 623666, 623666, 623872, 623872, 623888, 623888, 623904, 623904, 623905, 623905, 623920, 623920, 623921, 623921, 623922, 623922, 623922, 623922, 623936, 623936, 623937, 623937, 623938, 623938, 623938, 623938, 623939, 623939, 623939, 623939, 623939, 623939, 623939, 623939, 624128, 624128, 624144, 624144, 624160, 624160, 624161, 624161, 624176, 624176, 624177, 624177, 624178, 624178, 624178, 624178, 624192, 624192, 624193, 624193, 624194, 624194, 624194, 624194, 624195, 624195, 624195, 624195, 624195, 624195, 624195, 624195, 624208, 624208, 624209, 624209, 624210, 624210, 624210, 624210, 624211, 624211, 624211, 624211, 624211, 624211, 624211, 624211, 624212, 624212, 624212, 624212, 624212, 624212, 624212, 624212, 624212, 624212, 624212, 624212, 624212, 624212, 624212, 624212, 624384, 624384, 624400, 624400, 624416, 624416, 624417, 624417, 624432, 624432, 624433, 624433, 624434, 624434, 624434, 624434, 624448, 624448, 624449, 624449, 624450, 624450, 624450, 624450, 624451, 624451, 624451, 624451, 624451, 624451, 624451, 624451, 624464, 624464, 624465, 624465, 624466, 624466, 624466, 624466, 624467, 624467, 624467, 624467, 624467, 624467, 624467, 624467, 624468, 624468, 624468, 624468, 624468, 624468, 624468, 624468, 624468, 624468, 624468, 624468, 624468, 624468, 624468, 624468, 624480, 624480, 624481, 624481, 624482, 624482, 624482, 624482, 624483, 624483, 624483, 624483, 624483, 624483, 624483, 624483, 624484, 624484, 624484, 624484, 624484, 624484, 624484, 624484, 624484, 624484, 624484, 624484, 624484, 624484, 624484, 624484, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 624485, 655360, 655360, 659456, 659456, 663552, 663552, 663808, 663808, 667648, 667648, 667904, 667904, 668160, 668160, 668176, 668176, 671744, 671744, 672000, 672000, 672256, 672256, 672272, 672272, 672512, 672512, 672528, 672528, 672544, 672544, 672545, 672545, 675840, 675840, 676096, 676096, 676352, 676352, 676368, 676368, 676608, 676608, 676624, 676624, 676640, 676640, 676641, 676641, 676864, 676864, 676880, 676880, 676896, 676896, 676897, 676897, 676912, 676912, 676913, 676913, 676914, 676914, 676914, 676914, 679936, 679936, 680192, 680192, 680448, 680448, 680464, 680464, 680704, 680704, 680720, 680720, 680736, 680736, 680737, 680737, 680960, 680960, 680976, 680976, 680992, 680992, 680993, 680993, 681008, 681008, 681009, 681009, 681010, 681010, 681010, 681010, 681216, 681216, 681232, 681232, 681248, 681248, 681249, 681249, 681264, 681264, 681265, 681265, 681266, 681266, 681266, 681266, 681280, 681280, 681281, 681281, 681282, 681282, 681282, 681282, 681283, 681283, 681283, 681283, 681283, 681283, 681283, 681283, 684032, 684032, 684288, 684288, 684544, 684544, 684560, 684560, 684800, 684800, 684816, 684816, 684832, 684832, 684833, 684833, 685056, 685056, 685072, 685072, 685088, 685088, 685089, 685089, 685104, 685104, 685105, 685105, 685106, 685106, 685106, 685106, 685312, 685312, 685328, 685328, 685344, 685344, 685345, 685345, 685360, 685360, 685361, 685361, 685362, 685362, 685362, 685362, 685376, 685376, 685377, 685377, 685378, 685378, 685378, 685378, 685379, 685379, 685379, 685379, 685379, 685379, 685379, 685379, 685568, 685568, 685584, 685584, 685600, 685600, 685601, 685601, 685616, 685616, 685617, 685617, 685618, 685618, 685618, 685618, 685632, 685632, 685633, 685633, 685634, 685634, 685634, 685634, 685635, 685635, 685635, 685635, 685635, 685635, 685635, 685635, 685648, 685648, 685649, 685649, 685650, 685650, 685650, 685650, 685651, 685651, 685651, 685651, 685651, 685651, 685651, 685651, 685652, 685652, 685652, 685652, 685652, 685652, 685652, 685652, 685652, 685652, 685652, 685652, 685652, 685652, 685652, 685652, 688128, 688128, 688384, 688384, 688640, 688640, 688656, 688656, 688896, 688896, 688912, 688912, 688928, 688928, 688929, 688929, 689152, 689152, 689168, 689168, 689184, 689184, 689185, 689185, 689200, 689200, 689201, 689201, 689202, 689202, 689202, 689202, 689408, 689408, 689424, 689424, 689440, 689440, 689441, 689441, 689456, 689456, 689457, 689457, 689458, 689458, 689458, 689458, 689472, 689472, 689473, 689473, 689474, 689474, 689474, 689474, 689475, 689475, 689475, 689475, 689475, 689475, 689475, 689475, 689664, 689664, 689680, 689680, 689696, 689696, 689697, 689697, 689712, 689712, 689713, 689713, 689714, 689714, 689714, 689714, 689728, 689728, 689729, 689729, 689730, 689730, 689730, 689730, 689731, 689731, 689731, 689731, 689731, 689731, 689731, 689731, 689744, 689744, 689745, 689745, 689746, 689746, 689746, 689746, 689747, 689747, 689747, 689747, 689747, 689747, 689747, 689747, 689748, 689748, 689748, 689748, 689748, 689748, 689748, 689748, 689748, 689748, 689748, 689748, 689748, 689748, 689748, 689748, 689920, 689920, 689936, 689936, 689952, 689952, 689953, 689953, 689968, 689968, 689969, 689969, 689970, 689970, 689970, 689970, 689984, 689984, 689985, 689985, 689986, 689986, 689986, 689986, 689987, 689987, 689987, 689987, 689987, 689987, 689987, 689987, 690000, 690000, 690001, 690001, 690002, 690002, 690002, 690002, 690003, 690003, 690003, 690003, 690003, 690003, 690003, 690003, 690004, 690004, 690004, 690004, 690004, 690004, 690004, 690004, 690004, 690004, 690004, 690004, 690004, 690004, 690004, 690004, 690016, 690016, 690017, 690017, 690018, 690018, 690018, 690018, 690019, 690019, 690019, 690019, 690019, 690019, 690019, 690019, 690020, 690020, 690020, 690020, 690020, 690020, 690020, 690020, 690020, 690020, 690020, 690020, 690020, 690020, 690020, 690020, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 690021, 692224, 692224, 692480, 692480, 692736, 692736, 692752, 692752, 692992, 692992, 693008, 693008, 693024, 693024, 693025, 693025, 693248, 693248, 693264, 693264, 693280, 693280, 693281, 693281, 693296, 693296, 693297, 693297, 693298, 693298, 693298, 693298, 693504, 693504, 693520, 693520, 693536, 693536, 693537, 693537, 693552, 693552, 693553, 693553, 693554, 693554, 693554, 693554, 693568, 693568, 693569, 693569, 693570, 693570, 693570, 693570, 693571, 693571, 693571, 693571, 693571, 693571, 693571, 693571, 693760, 693760, 693776, 693776, 693792, 693792, 693793, 693793, 693808, 693808, 693809, 693809, 693810, 693810, 693810, 693810, 693824, 693824, 693825, 693825, 693826, 693826, 693826, 693826, 693827, 693827, 693827, 693827, 693827, 693827, 693827, 693827, 693840, 693840, 693841, 693841, 693842, 693842, 693842, 693842, 693843, 693843, 693843, 693843, 693843, 693843, 693843, 693843, 693844, 693844, 693844, 693844, 693844, 693844, 693844, 693844, 693844, 693844, 693844, 693844, 693844, 693844, 693844, 693844, 694016, 694016, 694032, 694032, 694048, 694048, 694049, 694049, 694064, 694064, 694065, 694065, 694066, 694066, 694066, 694066, 694080, 694080, 694081, 694081, 694082, 694082, 694082, 694082, 694083, 694083, 694083, 694083, 694083, 694083, 694083, 694083, 694096, 694096, 694097, 694097, 694098, 694098, 694098, 694098, 694099, 694099, 694099, 694099, 694099, 694099, 694099, 694099, 694100, 694100, 694100, 694100, 694100, 694100, 694100, 694100, 694100, 694100, 694100, 694100, 694100, 694100, 694100, 694100, 694112, 694112, 694113, 694113, 694114, 694114, 694114, 694114, 694115, 694115, 694115, 694115, 694115, 694115, 694115, 694115, 694116, 694116, 694116, 694116, 694116, 694116, 694116, 694116, 694116, 694116, 694116, 694116, 694116, 694116, 694116, 694116, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694117, 694272, 694272, 694288, 694288, 694304, 694304, 694305, 694305, 694320, 694320, 694321, 694321, 694322, 694322, 694322, 694322, 694336, 694336, 694337, 694337, 694338, 694338, 694338, 694338, 694339, 694339, 694339, 694339, 694339, 694339, 694339, 694339, 694352, 694352, 694353, 694353, 694354, 694354, 694354, 694354, 694355, 694355, 694355, 694355, 694355, 694355, 694355, 694355, 694356, 694356, 694356, 694356, 694356, 694356, 694356, 694356, 694356, 694356, 694356, 694356, 694356, 694356, 694356, 694356, 694368, 694368, 694369, 694369, 694370, 694370, 694370, 694370, 694371, 694371, 694371, 694371, 694371, 694371, 694371, 694371, 694372, 694372, 694372, 694372, 694372, 694372, 694372, 694372, 694372, 694372, 694372, 694372, 694372, 694372, 694372, 694372, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694373, 694384, 694384, 694385, 694385, 694386, 694386, 694386, 694386, 694387, 694387, 694387, 694387, 694387, 694387, 694387, 694387, 694388, 694388, 694388, 694388, 694388, 694388, 694388, 694388, 694388, 694388, 694388, 694388, 694388, 694388, 694388, 694388, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694389, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 694390, 720896, 720896, 724992, 724992, 729088, 729088, 729344, 729344, 733184, 733184, 733440, 733440, 733696, 733696, 733712, 733712, 737280, 737280, 737536, 737536, 737792, 737792, 737808, 737808, 738048, 738048, 738064, 738064, 738080, 738080, 738081, 738081, 741376, 741376, 741632, 741632, 741888, 741888, 741904, 741904, 742144, 742144, 742160, 742160, 742176, 742176, 742177, 742177, 742400, 742400, 742416, 742416, 742432, 742432, 742433, 742433, 742448, 742448, 742449, 742449, 742450, 742450, 742450, 742450, 745472, 745472, 745728, 745728, 745984, 745984, 746000, 746000, 746240, 746240, 746256, 746256, 746272, 746272, 746273, 746273, 746496, 746496, 746512, 746512, 746528, 746528, 746529, 746529, 746544, 746544, 746545, 746545, 746546, 746546, 746546, 746546, 746752, 746752, 746768, 746768, 746784, 746784, 746785, 746785, 746800, 746800, 746801, 746801, 746802, 746802, 746802, 746802, 746816, 746816, 746817, 746817, 746818, 746818, 746818, 746818, 746819, 746819, 746819, 746819, 746819, 746819, 746819, 746819, 749568, 749568, 749824, 749824, 750080, 750080, 750096, 750096, 750336, 750336, 750352, 750352, 750368, 750368, 750369, 750369, 750592, 750592, 750608, 750608, 750624, 750624, 750625, 750625, 750640, 750640, 750641, 750641, 750642, 750642, 750642, 750642, 750848, 750848, 750864, 750864, 750880, 750880, 750881, 750881, 750896, 750896, 750897, 750897, 750898, 750898, 750898, 750898, 750912, 750912, 750913, 750913, 750914, 750914, 750914, 750914, 750915, 750915, 750915, 750915, 750915, 750915, 750915, 750915, 751104, 751104, 751120, 751120, 751136, 751136, 751137, 751137, 751152, 751152, 751153, 751153, 751154, 751154, 751154, 751154, 751168, 751168, 751169, 751169, 751170, 751170, 751170, 751170, 751171, 751171, 751171, 751171, 751171, 751171, 751171, 751171, 751184, 751184, 751185, 751185, 751186, 751186, 751186, 751186, 751187, 751187, 751187, 751187, 751187, 751187, 751187, 751187, 751188, 751188, 751188, 751188, 751188, 751188, 751188, 751188, 751188, 751188, 751188, 751188, 751188, 751188, 751188, 751188, 753664, 753664, 753920, 753920, 754176, 754176, 754192, 754192, 754432, 754432, 754448, 754448, 754464, 754464, 754465, 754465, 754688, 754688, 754704, 754704, 754720, 754720, 754721, 754721, 754736, 754736, 754737, 754737, 754738, 754738, 754738, 754738, 754944, 754944, 754960, 754960, 754976, 754976, 754977, 754977, 754992, 754992, 754993, 754993, 754994, 754994, 754994, 754994, 755008, 755008, 755009, 755009, 755010, 755010, 755010, 755010, 755011, 755011, 755011, 755011, 755011, 755011, 755011, 755011, 755200, 755200, 755216, 755216, 755232, 755232, 755233, 755233, 755248, 755248, 755249, 755249, 755250, 755250, 755250, 755250, 755264, 755264, 755265, 755265, 755266, 755266, 755266, 755266, 755267, 755267, 755267, 755267, 755267, 755267, 755267, 755267, 755280, 755280, 755281, 755281, 755282, 755282, 755282, 755282, 755283, 755283, 755283, 755283, 755283, 755283, 755283, 755283, 755284, 755284, 755284, 755284, 755284, 755284, 755284, 755284, 755284, 755284, 755284, 755284, 755284, 755284, 755284, 755284, 755456, 755456, 755472, 755472, 755488, 755488, 755489, 755489, 755504, 755504, 755505, 755505, 755506, 755506, 755506, 755506, 755520, 755520, 755521, 755521, 755522, 755522, 755522, 755522, 755523, 755523, 755523, 755523, 755523, 755523, 755523, 755523, 755536, 755536, 755537, 755537, 755538, 755538, 755538, 755538, 755539, 755539, 755539, 755539, 755539, 755539, 755539, 755539, 755540, 755540, 755540, 755540, 755540, 755540, 755540, 755540, 755540, 755540, 755540, 755540, 755540, 755540, 755540, 755540, 755552, 755552, 755553, 755553, 755554, 755554, 755554, 755554, 755555, 755555, 755555, 755555, 755555, 755555, 755555, 755555, 755556, 755556, 755556, 755556, 755556, 755556, 755556, 755556, 755556, 755556, 755556, 755556, 755556, 755556, 755556, 755556, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 755557, 757760, 757760, 758016, 758016, 758272, 758272, 758288, 758288, 758528, 758528, 758544, 758544, 758560, 758560, 758561, 758561, 758784, 758784, 758800, 758800, 758816, 758816, 758817, 758817, 758832, 758832, 758833, 758833, 758834, 758834, 758834, 758834, 759040, 759040, 759056, 759056, 759072, 759072, 759073, 759073, 759088, 759088, 759089, 759089, 759090, 759090, 759090, 759090, 759104, 759104, 759105, 759105, 759106, 759106, 759106, 759106, 759107, 759107, 759107, 759107, 759107, 759107, 759107, 759107, 759296, 759296, 759312, 759312, 759328, 759328, 759329, 759329, 759344, 759344, 759345, 759345, 759346, 759346, 759346, 759346, 759360, 759360, 759361, 759361, 759362, 759362, 759362, 759362, 759363, 759363, 759363, 759363, 759363, 759363, 759363, 759363, 759376, 759376, 759377, 759377, 759378, 759378, 759378, 759378, 759379, 759379, 759379, 759379, 759379, 759379, 759379, 759379, 759380, 759380, 759380, 759380, 759380, 759380, 759380, 759380, 759380, 759380, 759380, 759380, 759380, 759380, 759380, 759380, 759552, 759552, 759568, 759568, 759584, 759584, 759585, 759585, 759600, 759600, 759601, 759601, 759602, 759602, 759602, 759602, 759616, 759616, 759617, 759617, 759618, 759618, 759618, 759618, 759619, 759619, 759619, 759619, 759619, 759619, 759619, 759619, 759632, 759632, 759633, 759633, 759634, 759634, 759634, 759634, 759635, 759635, 759635, 759635, 759635, 759635, 759635, 759635, 759636, 759636, 759636, 759636, 759636, 759636, 759636, 759636, 759636, 759636, 759636, 759636, 759636, 759636, 759636, 759636, 759648, 759648, 759649, 759649, 759650, 759650, 759650, 759650, 759651, 759651, 759651, 759651, 759651, 759651, 759651, 759651, 759652, 759652, 759652, 759652, 759652, 759652, 759652, 759652, 759652, 759652, 759652, 759652, 759652, 759652, 759652, 759652, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759653, 759808, 759808, 759824, 759824, 759840, 759840, 759841, 759841, 759856, 759856, 759857, 759857, 759858, 759858, 759858, 759858, 759872, 759872, 759873, 759873, 759874, 759874, 759874, 759874, 759875, 759875, 759875, 759875, 759875, 759875, 759875, 759875, 759888, 759888, 759889, 759889, 759890, 759890, 759890, 759890, 759891, 759891, 759891, 759891, 759891, 759891, 759891, 759891, 759892, 759892, 759892, 759892, 759892, 759892, 759892, 759892, 759892, 759892, 759892, 759892, 759892, 759892, 759892, 759892, 759904, 759904, 759905, 759905, 759906, 759906, 759906, 759906, 759907, 759907, 759907, 759907, 759907, 759907, 759907, 759907, 759908, 759908, 759908, 759908, 759908, 759908, 759908, 759908, 759908, 759908, 759908, 759908, 759908, 759908, 759908, 759908, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759909, 759920, 759920, 759921, 759921, 759922, 759922, 759922, 759922, 759923, 759923, 759923, 759923, 759923, 759923, 759923, 759923, 759924, 759924, 759924, 759924, 759924, 759924, 759924, 759924, 759924, 759924, 759924, 759924, 759924, 759924, 759924, 759924, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759925, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 759926, 761856, 761856, 762112, 762112, 762368, 762368, 762384, 762384, 762624, 762624, 762640, 762640, 762656, 762656, 762657, 762657, 762880, 762880, 762896, 762896, 762912, 762912, 762913, 762913, 762928, 762928, 762929, 762929, 762930, 762930, 762930, 762930, 763136, 763136, 763152, 763152, 763168, 763168, 763169, 763169, 763184, 763184, 763185, 763185, 763186, 763186, 763186, 763186, 763200, 763200, 763201, 763201, 763202, 763202, 763202, 763202, 763203, 763203, 763203, 763203, 763203, 763203, 763203, 763203, 763392, 763392, 763408, 763408, 763424, 763424, 763425, 763425, 763440, 763440, 763441, 763441, 763442, 763442, 763442, 763442, 763456, 763456, 763457, 763457, 763458, 763458, 763458, 763458, 763459, 763459, 763459, 763459, 763459, 763459, 763459, 763459, 763472, 763472, 763473, 763473, 763474, 763474, 763474, 763474, 763475, 763475, 763475, 763475, 763475, 763475, 763475, 763475, 763476, 763476, 763476, 763476, 763476, 763476, 763476, 763476, 763476, 763476, 763476, 763476, 763476, 763476, 763476, 763476, 763648, 763648, 763664, 763664, 763680, 763680, 763681, 763681, 763696, 763696, 763697, 763697, 763698, 763698, 763698, 763698, 763712, 763712, 763713, 763713, 763714, 763714, 763714, 763714, 763715, 763715, 763715, 763715, 763715, 763715, 763715, 763715, 763728, 763728, 763729, 763729, 763730, 763730, 763730, 763730, 763731, 763731, 763731, 763731, 763731, 763731, 763731, 763731, 763732, 763732, 763732, 763732, 763732, 763732, 763732, 763732, 763732, 763732, 763732, 763732, 763732, 763732, 763732, 763732, 763744, 763744, 763745, 763745, 763746, 763746, 763746, 763746, 763747, 763747, 763747, 763747, 763747, 763747, 763747, 763747, 763748, 763748, 763748, 763748, 763748, 763748, 763748, 763748, 763748, 763748, 763748, 763748, 763748, 763748, 763748, 763748, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763749, 763904, 763904, 763920, 763920, 763936, 763936, 763937, 763937, 763952, 763952, 763953, 763953, 763954, 763954, 763954, 763954, 763968, 763968, 763969, 763969, 763970, 763970, 763970, 763970, 763971, 763971, 763971, 763971, 763971, 763971, 763971, 763971, 763984, 763984, 763985, 763985, 763986, 763986, 763986, 763986, 763987, 763987, 763987, 763987, 763987, 763987, 763987, 763987, 763988, 763988, 763988, 763988, 763988, 763988, 763988, 763988, 763988, 763988, 763988, 763988, 763988, 763988, 763988, 763988, 764000, 764000, 764001, 764001, 764002, 764002, 764002, 764002, 764003, 764003, 764003, 764003, 764003, 764003, 764003, 764003, 764004, 764004, 764004, 764004, 764004, 764004, 764004, 764004, 764004, 764004, 764004, 764004, 764004, 764004, 764004, 764004, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764005, 764016, 764016, 764017, 764017, 764018, 764018, 764018, 764018, 764019, 764019, 764019, 764019, 764019, 764019, 764019, 764019, 764020, 764020, 764020, 764020, 764020, 764020, 764020, 764020, 764020, 764020, 764020, 764020, 764020, 764020, 764020, 764020, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764021, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764022, 764160, 764160, 764176, 764176, 764192, 764192, 764193, 764193, 764208, 764208, 764209, 764209, 764210, 764210, 764210, 764210, 764224, 764224, 764225, 764225, 764226, 764226, 764226, 764226, 764227, 764227, 764227, 764227, 764227, 764227, 764227, 764227, 764240, 764240, 764241, 764241, 764242, 764242, 764242, 764242, 764243, 764243, 764243, 764243, 764243, 764243, 764243, 764243, 764244, 764244, 764244, 764244, 764244, 764244, 764244, 764244, 764244, 764244, 764244, 764244, 764244, 764244, 764244, 764244, 764256, 764256, 764257, 764257, 764258, 764258, 764258, 764258, 764259, 764259, 764259, 764259, 764259, 764259, 764259, 764259, 764260, 764260, 764260, 764260, 764260, 764260, 764260, 764260, 764260, 764260, 764260, 764260, 764260, 764260, 764260, 764260, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764261, 764272, 764272, 764273, 764273, 764274, 764274, 764274, 764274, 764275, 764275, 764275, 764275, 764275, 764275, 764275, 764275, 764276, 764276, 764276, 764276, 764276, 764276, 764276, 764276, 764276, 764276, 764276, 764276, 764276, 764276, 764276, 764276, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764277, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764278, 764288, 764288, 764289, 764289, 764290, 764290, 764290, 764290, 764291, 764291, 764291, 764291, 764291, 764291, 764291, 764291, 764292, 764292, 764292, 764292, 764292, 764292, 764292, 764292, 764292, 764292, 764292, 764292, 764292, 764292, 764292, 764292, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764293, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764294, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 764295, 786432, 786432, 790528, 790528, 794624, 794624, 794880, 794880, 798720, 798720, 798976, 798976, 799232, 799232, 799248, 799248, 802816, 802816, 803072, 803072, 803328, 803328, 803344, 803344, 803584, 803584, 803600, 803600, 803616, 803616, 803617, 803617, 806912, 806912, 807168, 807168, 807424, 807424, 807440, 807440, 807680, 807680, 807696, 807696, 807712, 807712, 807713, 807713, 807936, 807936, 807952, 807952, 807968, 807968, 807969, 807969, 807984, 807984, 807985, 807985, 807986, 807986, 807986, 807986, 811008, 811008, 811264, 811264, 811520, 811520, 811536, 811536, 811776, 811776, 811792, 811792, 811808, 811808, 811809, 811809, 812032, 812032, 812048, 812048, 812064, 812064, 812065, 812065, 812080, 812080, 812081, 812081, 812082, 812082, 812082, 812082, 812288, 812288, 812304, 812304, 812320, 812320, 812321, 812321, 812336, 812336, 812337, 812337, 812338, 812338, 812338, 812338, 812352, 812352, 812353, 812353, 812354, 812354, 812354, 812354, 812355, 812355, 812355, 812355, 812355, 812355, 812355, 812355, 815104, 815104, 815360, 815360, 815616, 815616, 815632, 815632, 815872, 815872, 815888, 815888, 815904, 815904, 815905, 815905, 816128, 816128, 816144, 816144, 816160, 816160, 816161, 816161, 816176, 816176, 816177, 816177, 816178, 816178, 816178, 816178, 816384, 816384, 816400, 816400, 816416, 816416, 816417, 816417, 816432, 816432, 816433, 816433, 816434, 816434, 816434, 816434, 816448, 816448, 816449, 816449, 816450, 816450, 816450, 816450, 816451, 816451, 816451, 816451, 816451, 816451, 816451, 816451, 816640, 816640, 816656, 816656, 816672, 816672, 816673, 816673, 816688, 816688, 816689, 816689, 816690, 816690, 816690, 816690, 816704, 816704, 816705, 816705, 816706, 816706, 816706, 816706, 816707, 816707, 816707, 816707, 816707, 816707, 816707, 816707, 816720, 816720, 816721, 816721, 816722, 816722, 816722, 816722, 816723, 816723, 816723, 816723, 816723, 816723, 816723, 816723, 816724, 816724, 816724, 816724, 816724, 816724, 816724, 816724, 816724, 816724, 816724, 816724, 816724, 816724, 816724, 816724, 819200, 819200, 819456, 819456, 819712, 819712, 819728, 819728, 819968, 819968, 819984, 819984, 820000, 820000, 820001, 820001, 820224, 820224, 820240, 820240, 820256, 820256, 820257, 820257, 820272, 820272, 820273, 820273, 820274, 820274, 820274, 820274, 820480, 820480, 820496, 820496, 820512, 820512, 820513, 820513, 820528, 820528, 820529, 820529, 820530, 820530, 820530, 820530, 820544, 820544, 820545, 820545, 820546, 820546, 820546, 820546, 820547, 820547, 820547, 820547, 820547, 820547, 820547, 820547, 820736, 820736, 820752, 820752, 820768, 820768, 820769, 820769, 820784, 820784, 820785, 820785, 820786, 820786, 820786, 820786, 820800, 820800, 820801, 820801, 820802, 820802, 820802, 820802, 820803, 820803, 820803, 820803, 820803, 820803, 820803, 820803, 820816, 820816, 820817, 820817, 820818, 820818, 820818, 820818, 820819, 820819, 820819, 820819, 820819, 820819, 820819, 820819, 820820, 820820, 820820, 820820, 820820, 820820, 820820, 820820, 820820, 820820, 820820, 820820, 820820, 820820, 820820, 820820, 820992, 820992, 821008, 821008, 821024, 821024, 821025, 821025, 821040, 821040, 821041, 821041, 821042, 821042, 821042, 821042, 821056, 821056, 821057, 821057, 821058, 821058, 821058, 821058, 821059, 821059, 821059, 821059, 821059, 821059, 821059, 821059, 821072, 821072, 821073, 821073, 821074, 821074, 821074, 821074, 821075, 821075, 821075, 821075, 821075, 821075, 821075, 821075, 821076, 821076, 821076, 821076, 821076, 821076, 821076, 821076, 821076, 821076, 821076, 821076, 821076, 821076, 821076, 821076, 821088, 821088, 821089, 821089, 821090, 821090, 821090, 821090, 821091, 821091, 821091, 821091, 821091, 821091, 821091, 821091, 821092, 821092, 821092, 821092, 821092, 821092, 821092, 821092, 821092, 821092, 821092, 821092, 821092, 821092, 821092, 821092, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 821093, 823296, 823296, 823552, 823552, 823808, 823808, 823824, 823824, 824064, 824064, 824080, 824080, 824096, 824096, 824097, 824097, 824320, 824320, 824336, 824336, 824352, 824352, 824353, 824353, 824368, 824368, 824369, 824369, 824370, 824370, 824370, 824370, 824576, 824576, 824592, 824592, 824608, 824608, 824609, 824609, 824624, 824624, 824625, 824625, 824626, 824626, 824626, 824626, 824640, 824640, 824641, 824641, 824642, 824642, 824642, 824642, 824643, 824643, 824643, 824643, 824643, 824643, 824643, 824643, 824832, 824832, 824848, 824848, 824864, 824864, 824865, 824865, 824880, 824880, 824881, 824881, 824882, 824882, 824882, 824882, 824896, 824896, 824897, 824897, 824898, 824898, 824898, 824898, 824899, 824899, 824899, 824899, 824899, 824899, 824899, 824899, 824912, 824912, 824913, 824913, 824914, 824914, 824914, 824914, 824915, 824915, 824915, 824915, 824915, 824915, 824915, 824915, 824916, 824916, 824916, 824916, 824916, 824916, 824916, 824916, 824916, 824916, 824916, 824916, 824916, 824916, 824916, 824916, 825088, 825088, 825104, 825104, 825120, 825120, 825121, 825121, 825136, 825136, 825137, 825137, 825138, 825138, 825138, 825138, 825152, 825152, 825153, 825153, 825154, 825154, 825154, 825154, 825155, 825155, 825155, 825155, 825155, 825155, 825155, 825155, 825168, 825168, 825169, 825169, 825170, 825170, 825170, 825170, 825171, 825171, 825171, 825171, 825171, 825171, 825171, 825171, 825172, 825172, 825172, 825172, 825172, 825172, 825172, 825172, 825172, 825172, 825172, 825172, 825172, 825172, 825172, 825172, 825184, 825184, 825185, 825185, 825186, 825186, 825186, 825186, 825187, 825187, 825187, 825187, 825187, 825187, 825187, 825187, 825188, 825188, 825188, 825188, 825188, 825188, 825188, 825188, 825188, 825188, 825188, 825188, 825188, 825188, 825188, 825188, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825189, 825344, 825344, 825360, 825360, 825376, 825376, 825377, 825377, 825392, 825392, 825393, 825393, 825394, 825394, 825394, 825394, 825408, 825408, 825409, 825409, 825410, 825410, 825410, 825410, 825411, 825411, 825411, 825411, 825411, 825411, 825411, 825411, 825424, 825424, 825425, 825425, 825426, 825426, 825426, 825426, 825427, 825427, 825427, 825427, 825427, 825427, 825427, 825427, 825428, 825428, 825428, 825428, 825428, 825428, 825428, 825428, 825428, 825428, 825428, 825428, 825428, 825428, 825428, 825428, 825440, 825440, 825441, 825441, 825442, 825442, 825442, 825442, 825443, 825443, 825443, 825443, 825443, 825443, 825443, 825443, 825444, 825444, 825444, 825444, 825444, 825444, 825444, 825444, 825444, 825444, 825444, 825444, 825444, 825444, 825444, 825444, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825445, 825456, 825456, 825457, 825457, 825458, 825458, 825458, 825458, 825459, 825459, 825459, 825459, 825459, 825459, 825459, 825459, 825460, 825460, 825460, 825460, 825460, 825460, 825460, 825460, 825460, 825460, 825460, 825460, 825460, 825460, 825460, 825460, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825461, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 825462, 827392, 827392, 827648, 827648, 827904, 827904, 827920, 827920, 828160, 828160, 828176, 828176, 828192, 828192, 828193, 828193, 828416, 828416, 828432, 828432, 828448, 828448, 828449, 828449, 828464, 828464, 828465, 828465, 828466, 828466, 828466, 828466, 828672, 828672, 828688, 828688, 828704, 828704, 828705, 828705, 828720, 828720, 828721, 828721, 828722, 828722, 828722, 828722, 828736, 828736, 828737, 828737, 828738, 828738, 828738, 828738, 828739, 828739, 828739, 828739, 828739, 828739, 828739, 828739, 828928, 828928, 828944, 828944, 828960, 828960, 828961, 828961, 828976, 828976, 828977, 828977, 828978, 828978, 828978, 828978, 828992, 828992, 828993, 828993, 828994, 828994, 828994, 828994, 828995, 828995, 828995, 828995, 828995, 828995, 828995, 828995, 829008, 829008, 829009, 829009, 829010, 829010, 829010, 829010, 829011, 829011, 829011, 829011, 829011, 829011, 829011, 829011, 829012, 829012, 829012, 829012, 829012, 829012, 829012, 829012, 829012, 829012, 829012, 829012, 829012, 829012, 829012, 829012, 829184, 829184, 829200, 829200, 829216, 829216, 829217, 829217, 829232, 829232, 829233, 829233, 829234, 829234, 829234, 829234, 829248, 829248, 829249, 829249, 829250, 829250, 829250, 829250, 829251, 829251, 829251, 829251, 829251, 829251, 829251, 829251, 829264, 829264, 829265, 829265, 829266, 829266, 829266, 829266, 829267, 829267, 829267, 829267, 829267, 829267, 829267, 829267, 829268, 829268, 829268, 829268, 829268, 829268, 829268, 829268, 829268, 829268, 829268, 829268, 829268, 829268, 829268, 829268, 829280, 829280, 829281, 829281, 829282, 829282, 829282, 829282, 829283, 829283, 829283, 829283, 829283, 829283, 829283, 829283, 829284, 829284, 829284, 829284, 829284, 829284, 829284, 829284, 829284, 829284, 829284, 829284, 829284, 829284, 829284, 829284, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829285, 829440, 829440, 829456, 829456, 829472, 829472, 829473, 829473, 829488, 829488, 829489, 829489, 829490, 829490, 829490, 829490, 829504, 829504, 829505, 829505, 829506, 829506, 829506, 829506, 829507, 829507, 829507, 829507, 829507, 829507, 829507, 829507, 829520, 829520, 829521, 829521, 829522, 829522, 829522, 829522, 829523, 829523, 829523, 829523, 829523, 829523, 829523, 829523, 829524, 829524, 829524, 829524, 829524, 829524, 829524, 829524, 829524, 829524, 829524, 829524, 829524, 829524, 829524, 829524, 829536, 829536, 829537, 829537, 829538, 829538, 829538, 829538, 829539, 829539, 829539, 829539, 829539, 829539, 829539, 829539, 829540, 829540, 829540, 829540, 829540, 829540, 829540, 829540, 829540, 829540, 829540, 829540, 829540, 829540, 829540, 829540, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829541, 829552, 829552, 829553, 829553, 829554, 829554, 829554, 829554, 829555, 829555, 829555, 829555, 829555, 829555, 829555, 829555, 829556, 829556, 829556, 829556, 829556, 829556, 829556, 829556, 829556, 829556, 829556, 829556, 829556, 829556, 829556, 829556, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829557, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829558, 829696, 829696, 829712, 829712, 829728, 829728, 829729, 829729, 829744, 829744, 829745, 829745, 829746, 829746, 829746, 829746, 829760, 829760, 829761, 829761, 829762, 829762, 829762, 829762, 829763, 829763, 829763, 829763, 829763, 829763, 829763, 829763, 829776, 829776, 829777, 829777, 829778, 829778, 829778, 829778, 829779, 829779, 829779, 829779, 829779, 829779, 829779, 829779, 829780, 829780, 829780, 829780, 829780, 829780, 829780, 829780, 829780, 829780, 829780, 829780, 829780, 829780, 829780, 829780, 829792, 829792, 829793, 829793, 829794, 829794, 829794, 829794, 829795, 829795, 829795, 829795, 829795, 829795, 829795, 829795, 829796, 829796, 829796, 829796, 829796, 829796, 829796, 829796, 829796, 829796, 829796, 829796, 829796, 829796, 829796, 829796, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829797, 829808, 829808, 829809, 829809, 829810, 829810, 829810, 829810, 829811, 829811, 829811, 829811, 829811, 829811, 829811, 829811, 829812, 829812, 829812, 829812, 829812, 829812, 829812, 829812, 829812, 829812, 829812, 829812, 829812, 829812, 829812, 829812, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829813, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829814, 829824, 829824, 829825, 829825, 829826, 829826, 829826, 829826, 829827, 829827, 829827, 829827, 829827, 829827, 829827, 829827, 829828, 829828, 829828, 829828, 829828, 829828, 829828, 829828, 829828, 829828, 829828, 829828, 829828, 829828, 829828, 829828, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829829, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829830, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 829831, 831488, 831488, 831744, 831744, 832000, 832000, 832016, 832016, 832256, 832256, 832272, 832272, 832288, 832288, 832289, 832289, 832512, 832512, 832528, 832528, 832544, 832544, 832545, 832545, 832560, 832560, 832561, 832561, 832562, 832562, 832562, 832562, 832768, 832768, 832784, 832784, 832800, 832800, 832801, 832801, 832816, 832816, 832817, 832817, 832818, 832818, 832818, 832818, 832832, 832832, 832833, 832833, 832834, 832834, 832834, 832834, 832835, 832835, 832835, 832835, 832835, 832835, 832835, 832835, 833024, 833024, 833040, 833040, 833056, 833056, 833057, 833057, 833072, 833072, 833073, 833073, 833074, 833074, 833074, 833074, 833088, 833088, 833089, 833089, 833090, 833090, 833090, 833090, 833091, 833091, 833091, 833091, 833091, 833091, 833091, 833091, 833104, 833104, 833105, 833105, 833106, 833106, 833106, 833106, 833107, 833107, 833107, 833107, 833107, 833107, 833107, 833107, 833108, 833108, 833108, 833108, 833108, 833108, 833108, 833108, 833108, 833108, 833108, 833108, 833108, 833108, 833108, 833108, 833280, 833280, 833296, 833296, 833312, 833312, 833313, 833313, 833328, 833328, 833329, 833329, 833330, 833330, 833330, 833330, 833344, 833344, 833345, 833345, 833346, 833346, 833346, 833346, 833347, 833347, 833347, 833347, 833347, 833347, 833347, 833347, 833360, 833360, 833361, 833361, 833362, 833362, 833362, 833362, 833363, 833363, 833363, 833363, 833363, 833363, 833363, 833363, 833364, 833364, 833364, 833364, 833364, 833364, 833364, 833364, 833364, 833364, 833364, 833364, 833364, 833364, 833364, 833364, 833376, 833376, 833377, 833377, 833378, 833378, 833378, 833378, 833379, 833379, 833379, 833379, 833379, 833379, 833379, 833379, 833380, 833380, 833380, 833380, 833380, 833380, 833380, 833380, 833380, 833380, 833380, 833380, 833380, 833380, 833380, 833380, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833381, 833536, 833536, 833552, 833552, 833568, 833568, 833569, 833569, 833584, 833584, 833585, 833585, 833586, 833586, 833586, 833586, 833600, 833600, 833601, 833601, 833602, 833602, 833602, 833602, 833603, 833603, 833603, 833603, 833603, 833603, 833603, 833603, 833616, 833616, 833617, 833617, 833618, 833618, 833618, 833618, 833619, 833619, 833619, 833619, 833619, 833619, 833619, 833619, 833620, 833620, 833620, 833620, 833620, 833620, 833620, 833620, 833620, 833620, 833620, 833620, 833620, 833620, 833620, 833620, 833632, 833632, 833633, 833633, 833634, 833634, 833634, 833634, 833635, 833635, 833635, 833635, 833635, 833635, 833635, 833635, 833636, 833636, 833636, 833636, 833636, 833636, 833636, 833636, 833636, 833636, 833636, 833636, 833636, 833636, 833636, 833636, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833637, 833648, 833648, 833649, 833649, 833650, 833650, 833650, 833650, 833651, 833651, 833651, 833651, 833651, 833651, 833651, 833651, 833652, 833652, 833652, 833652, 833652, 833652, 833652, 833652, 833652, 833652, 833652, 833652, 833652, 833652, 833652, 833652, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833653, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833654, 833792, 833792, 833808, 833808, 833824, 833824, 833825, 833825, 833840, 833840, 833841, 833841, 833842, 833842, 833842, 833842, 833856, 833856, 833857, 833857, 833858, 833858, 833858, 833858, 833859, 833859, 833859, 833859, 833859, 833859, 833859, 833859, 833872, 833872, 833873, 833873, 833874, 833874, 833874, 833874, 833875, 833875, 833875, 833875, 833875, 833875, 833875, 833875, 833876, 833876, 833876, 833876, 833876, 833876, 833876, 833876, 833876, 833876, 833876, 833876, 833876, 833876, 833876, 833876, 833888, 833888, 833889, 833889, 833890, 833890, 833890, 833890, 833891, 833891, 833891, 833891, 833891, 833891, 833891, 833891, 833892, 833892, 833892, 833892, 833892, 833892, 833892, 833892, 833892, 833892, 833892, 833892, 833892, 833892, 833892, 833892, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833893, 833904, 833904, 833905, 833905, 833906, 833906, 833906, 833906, 833907, 833907, 833907, 833907, 833907, 833907, 833907, 833907, 833908, 833908, 833908, 833908, 833908, 833908, 833908, 833908, 833908, 833908, 833908, 833908, 833908, 833908, 833908, 833908, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833909, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833910, 833920, 833920, 833921, 833921, 833922, 833922, 833922, 833922, 833923, 833923, 833923, 833923, 833923, 833923, 833923, 833923, 833924, 833924, 833924, 833924, 833924, 833924, 833924, 833924, 833924, 833924, 833924, 833924, 833924, 833924, 833924, 833924, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833925, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833926, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 833927, 834048, 834048, 834064, 834064, 834080, 834080, 834081, 834081, 834096, 834096, 834097, 834097, 834098, 834098, 834098, 834098, 834112, 834112, 834113, 834113, 834114, 834114, 834114, 834114, 834115, 834115, 834115, 834115, 834115, 834115, 834115, 834115, 834128, 834128, 834129, 834129, 834130, 834130, 834130, 834130, 834131, 834131, 834131, 834131, 834131, 834131, 834131, 834131, 834132, 834132, 834132, 834132, 834132, 834132, 834132, 834132, 834132, 834132, 834132, 834132, 834132, 834132, 834132, 834132, 834144, 834144, 834145, 834145, 834146, 834146, 834146, 834146, 834147, 834147, 834147, 834147, 834147, 834147, 834147, 834147, 834148, 834148, 834148, 834148, 834148, 834148, 834148, 834148, 834148, 834148, 834148, 834148, 834148, 834148, 834148, 834148, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834149, 834160, 834160, 834161, 834161, 834162, 834162, 834162, 834162, 834163, 834163, 834163, 834163, 834163, 834163, 834163, 834163, 834164, 834164, 834164, 834164, 834164, 834164, 834164, 834164, 834164, 834164, 834164, 834164, 834164, 834164, 834164, 834164, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834165, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834166, 834176, 834176, 834177, 834177, 834178, 834178, 834178, 834178, 834179, 834179, 834179, 834179, 834179, 834179, 834179, 834179, 834180, 834180, 834180, 834180, 834180, 834180, 834180, 834180, 834180, 834180, 834180, 834180, 834180, 834180, 834180, 834180, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834181, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834182, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834183, 834192, 834192, 834193, 834193, 834194, 834194, 834194, 834194, 834195, 834195, 834195, 834195, 834195, 834195, 834195, 834195, 834196, 834196, 834196, 834196, 834196, 834196, 834196, 834196, 834196, 834196, 834196, 834196, 834196, 834196, 834196, 834196, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834197, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834198, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834199, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200, 834200};
 unsigned short TOP_CARD_TABLE[8192] = {0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12};
 unsigned long long CARD_MASKS_TABLE[52] = { 1ULL, 1ULL<<1, 1ULL<<2, 1ULL<<3, 1ULL<<4, 1ULL<<5, 1ULL<<6, 1ULL<<7, 1ULL<<8, 1ULL<<9, 1ULL<<10, 1ULL<<11, 1ULL<<12, 1ULL<<13, 1ULL<<14, 1ULL<<15, 1ULL<<16, 1ULL<<17, 1ULL<<18, 1ULL<<19, 1ULL<<20, 1ULL<<21, 1ULL<<22, 1ULL<<23, 1ULL<<24, 1ULL<<25, 1ULL<<26, 1ULL<<27, 1ULL<<28, 1ULL<<29, 1ULL<<30, 1ULL<<31, 1ULL<<32, 1ULL<<33, 1ULL<<34, 1ULL<<35, 1ULL<<36, 1ULL<<37, 1ULL<<38, 1ULL<<39, 1ULL<<40, 1ULL<<41, 1ULL<<42, 1ULL<<43, 1ULL<<44, 1ULL<<45, 1ULL<<46, 1ULL<<47, 1ULL<<48, 1ULL<<49, 1ULL<<50, 1ULL<<51};
+unsigned int RANK_HASH_OFFSETS[1911] = {0, 51549, 3613, 115473, 37973, 21249, 16976, 55902, 73449, 78436, 87147, 31805, 146930, 115728, 75869, 29759, 57582, 154286, 33798, 22758, 19276, 62905, 52972, 105028, 129108, 158542, 25167, 98772, 101230, 31244, 72929, 142949, 155656, 54284, 38088, 38712, 5596, 164410, 880, 99271, 22814, 83657, 76221, 139818, 913, 169111, 131268, 91950, 90243, 78760, 29134, 11550, 163370, 256, 85716, 8, 11285, 43800, 5018, 9355, 0, 122059, 26724, 125183, 7425, 91671, 28457, 149502, 108515, 65565, 77811, 136205, 144811, 45904, 4489, 118692, 102932, 170686, 5385, 39905, 10618, 155895, 15297, 34883, 63843, 138653, 135054, 154325, 111150, 21212, 94696, 44773, 92074, 473, 79842, 118425, 78459, 30894, 76, 9019, 3, 100163, 7, 10956, 1940, 71390, 10177, 169707, 4863, 100460, 24949, 4896, 44047, 6362, 9794, 8, 87179, 23, 11643, 0, 2, 10710, 17, 0, 0, 173449, 5787, 6864, 41203, 78996, 97607, 15308, 170836, 140297, 153037, 48, 36893, 2637, 1039, 171486, 2161, 99617, 17, 368, 9036, 15281, 868, 128, 146025, 167459, 119835, 57111, 21200, 1363, 164877, 13185, 71786, 60291, 133271, 47542, 111583, 45254, 63631, 93833, 70904, 159875, 142628, 74477, 44910, 11670, 15631, 57970, 162312, 446, 83606, 27012, 85454, 132703, 5260, 14966, 161191, 119034, 104730, 15543, 4832, 149, 27180, 63138, 12, 109417, 2, 222, 98976, 56971, 157844, 399, 88372, 99385, 149856, 14121, 55708, 1595, 36130, 44420, 1235, 11078, 31, 86457, 210, 2627, 2, 32, 83045, 37461, 25746, 64, 512, 87482, 17235, 58259, 140259, 64914, 107826, 87063, 19398, 117087, 4714, 50531, 2295, 71914, 121111, 79241, 32296, 782, 10192, 5913, 88230, 31658, 2151, 16208, 125974, 15190, 46166, 19, 75738, 173627, 1584, 45175, 2723, 10852, 908, 1427, 0, 9138, 0, 13, 163300, 6699, 87555, 21, 161871, 8988, 38964, 13, 4649, 44471, 1856, 4638, 35, 0, 1, 11186, 0, 0, 0, 0, 747, 12460, 10588, 11, 6305, 12270, 5085, 34779, 12294, 96892, 61457, 23008, 7330, 163738, 7568, 79482, 1, 11861, 45251, 7428, 10744, 8050, 3, 0, 12223, 12619, 0, 9027, 18832, 2, 82695, 0, 12537, 50896, 53945, 90222, 100654, 155958, 6903, 63238, 123372, 117556, 173212, 9071, 12186, 11753, 29414, 413, 51322, 1, 9785, 52699, 38, 8312, 19, 121670, 86422, 160831, 12198, 75115, 110315, 77786, 26098, 1750, 1035, 17, 100230, 2, 7559, 0, 28, 75855, 76757, 46433, 1053, 82242, 88937, 35051, 7481, 5916, 0, 82410, 2250, 7199, 3, 10616, 109856, 34867, 158952, 123984, 74359, 69629, 39319, 92148, 10421, 18552, 105286, 29693, 105863, 152815, 33984, 117727, 44662, 54293, 156534, 81080, 87582, 125286, 52630, 40157, 73638, 102152, 50181, 169073, 7374, 12457, 29771, 2215, 28182, 44424, 3544, 56467, 88966, 3166, 25105, 8797, 137652, 5218, 170321, 799, 49501, 123563, 52512, 34171, 7636, 30943, 8400, 137, 4, 22264, 12852, 178, 340, 7, 0, 12640, 46199, 1672, 24792, 43511, 75894, 111346, 65243, 174055, 141005, 151353, 5555, 39108, 15, 83572, 163108, 7975, 18830, 24329, 4622, 4573, 14856, 8168, 24983, 144401, 161635, 115330, 60423, 9554, 485, 165351, 716, 89119, 5, 6675, 14328, 7716, 10469, 89679, 3, 7179, 12107, 0, 3883, 1, 80442, 48286, 57242, 8097, 63913, 83520, 34155, 31253, 2157, 12, 21, 74153, 83, 4029, 1, 1, 2564, 1, 0, 17, 25974, 1169, 26444, 112846, 31311, 169442, 36183, 19400, 5471, 66766, 1581, 135, 1, 8817, 89746, 1, 10219, 248, 490, 396, 3163, 1792, 7472, 36929, 90808, 17016, 3980, 88, 114, 101189, 67264, 134887, 31236, 167745, 100478, 83158, 96358, 61234, 95108, 802, 89772, 32538, 73155, 26245, 152419, 3422, 46274, 91559, 2438, 68862, 3571, 140817, 9671, 168193, 9208, 42409, 80040, 4210, 48118, 9087, 3849, 2, 94070, 0, 51166, 13501, 916, 162411, 230, 23706, 803, 165333, 24683, 61674, 156, 1210, 6279, 4653, 11902, 13554, 52, 53, 11841, 22, 27, 3, 1, 10933, 8553, 11067, 11, 24850, 12853, 5859, 146698, 171165, 64790, 70856, 25474, 1837, 166370, 1428, 93314, 58, 12509, 36811, 8770, 11273, 65776, 5, 8312, 12928, 9201, 4074, 5473, 40570, 56, 95327, 13, 8711, 48568, 9648, 13009, 3, 2, 0, 13563, 0, 4970, 0, 0, 94566, 1, 12214, 0, 50714, 4794, 17417, 9792, 1181, 28, 33479, 2, 9489, 0, 1, 4078, 1, 0, 1, 0, 12896, 2, 0, 0, 12298, 2503, 291, 95274, 102075, 27537, 139, 12726, 0, 95747, 1, 13008, 1, 0, 13176, 0, 2, 9187, 0, 0, 0, 9019, 0, 1, 103389, 69, 9420, 0, 0, 13928, 6885, 155187, 17767, 68428, 52, 96820, 174684, 8573, 49998, 10201, 13617, 3, 84350, 0, 69086, 56, 6297, 6223, 12, 0, 10261, 171979, 9171, 95748, 1, 145, 50140, 3744, 1533, 4, 0, 0, 12525, 0, 152, 20, 0, 39628, 10136, 13284, 0, 39832, 13517, 6600, 0, 1, 0, 13263, 3, 0, 0, 48213, 159578, 126805, 43375, 93068, 12435, 149691, 24819, 29299, 34, 104708, 166777, 9235, 22286, 9341, 4432, 66756, 508, 13816, 3914, 37469, 157397, 52678, 22645, 9093, 995, 172491, 1345, 95879, 12, 5213, 7078, 4415, 423, 83917, 0, 8361, 12698, 0, 249, 127, 173160, 3418, 104586, 16, 9318, 51324, 3088, 13105, 1, 9169, 0, 9406, 0, 9260, 2, 0, 2, 0, 0, 1, 52063, 14408, 13782, 127835, 71059, 174350, 5135, 52610, 44872, 7831, 51, 85668, 1, 14000, 33754, 29, 38, 1546, 0, 14529, 866, 5, 153, 55582, 83486, 31544, 2514, 382, 128, 104594, 5, 13032, 0, 0, 33, 0, 0, 9174, 0, 3, 0, 0, 2, 0, 110285, 10088, 78628, 0, 9182, 31621, 1052, 1286, 119, 0, 20, 9560, 0, 0, 0, 0, 0, 0, 0, 0, 17900, 10698, 5557, 172800, 4319, 60800, 912, 14002, 7116, 5691, 0, 10835, 0, 1, 14364, 104, 575, 7, 0, 9, 1, 11282, 10, 32063, 10235, 77, 104, 0, 38, 13343, 147149, 168658, 60997, 96434, 36784, 10192, 166607, 910, 104948, 0, 13125, 39853, 10464, 1846, 388, 3, 3600, 13491, 43, 5457, 0, 171301, 10982, 106182, 0, 10595, 52410, 11401, 13470, 0, 1, 0, 14126, 0, 9070, 2, 5, 36505, 130, 14350, 11, 37338, 484, 3709, 0, 3, 0, 14798, 2, 0, 0, 10, 0, 0, 0, 2, 0, 13127, 1, 0, 0, 12893, 8, 0, 58484, 106204, 47283, 4815, 1831, 95, 106311, 53, 13491, 0, 0, 13252, 0, 1, 10667, 0, 0, 0, 0, 1, 0, 106955, 2, 14133, 0, 0, 14032, 1, 0, 0, 0, 0, 5, 0, 0, 0, 0, 13191, 0, 0, 0, 37653, 11710, 2819, 5, 1, 0, 11399, 0, 4, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 714, 52, 0, 41050, 14300, 13386, 2, 0, 0, 13960, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 14618, 0, 3, 0, 0, 10, 1179, 6045, 59, 107239, 1, 14433, 53763, 11684, 14121, 9, 0, 0, 14851, 0, 9498, 0, 0, 0, 0, 0, 0, 62776, 172, 14766, 90, 0, 439, 0, 0, 0, 0, 0, 1, 0, 0, 51, 0, 13781, 0, 0, 0, 13557, 0, 3, 0, 0, 0, 0, 0, 0, 0, 130512, 33015, 113120, 98223, 56783, 18948, 52521, 41, 97162, 5, 14530, 41037, 11849, 14256, 97805, 20, 14880, 14984, 0, 9958, 24111, 57849, 9532, 5132, 0, 11828, 106217, 2, 14915, 200, 2, 1697, 38, 0, 10268, 0, 1, 0, 0, 0, 129, 107694, 20, 14031, 0, 0, 13682, 0, 0, 0, 7, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 14321, 0, 1, 104833, 5612, 57926, 11900, 14265, 9, 98832, 215, 14937, 0, 2, 14666, 0, 17, 15227, 0, 1, 1, 2, 1, 57923, 10681, 690, 56, 0, 1, 13770, 0, 0, 0, 0, 0, 167, 0, 1, 0, 0, 0, 0, 0, 0, 81053, 0, 10509, 0, 0, 1569, 130, 0, 116, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 8756, 0, 0, 21512, 74, 14615, 4, 0, 0, 15367, 0, 7, 0, 0, 2, 0, 0, 24, 0, 0, 0, 8, 0, 1973, 131, 0, 120, 0, 0, 2, 66914, 99098, 16965, 4550, 676, 85, 108710, 10, 13855, 0, 4, 2027, 178, 0, 4920, 0, 28, 1, 0, 4, 0, 109725, 12, 14496, 0, 0, 14117, 36, 0, 0, 0, 0, 2, 0, 1, 0, 0, 15016, 132, 0, 0, 14800, 5, 46, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 187, 0, 58330, 11514, 2147, 123, 0, 105, 14193, 0, 2, 0, 0, 2, 0, 0, 5, 0, 0, 0, 0, 0, 0, 14851, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9719, 7, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 13794, 0, 8, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110652, 0, 14886, 0, 7, 14785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15436, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127647, 111309, 41977, 15352, 14559, 0, 99910, 1, 15035, 0, 3, 14928, 0, 5, 15330, 0, 1, 4, 0, 0, 625, 6182, 0, 15796, 0, 4, 15568, 217, 4, 0, 0, 0, 3, 0, 4, 0, 0, 0, 0, 0, 0, 14577, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 59320, 15849, 14884, 18, 0, 0, 15596, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 832, 113, 0, 72, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10516, 0, 6, 0, 0, 0, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15193, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 0, 0, 0, 0, 0, 5359, 5000, 862, 103, 0, 54, 14404, 0, 11, 0, 0, 0, 154, 0, 10, 0, 0, 0, 0, 0, 0, 15096, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2313, 125, 0, 97, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15386, 0, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
@@ -1,7 +1,22 @@
+#include <cassert>
+#include <numeric>
+
 #include "equity.h"
 
-thread_local random_device rd;
-thread_local mt19937 gen(rd());
+thread_local FastRNG gen(random_seed());
+
+// add 2 to count for each hero win and 1 for each tie
+static inline void tally_showdowns(const int hero[], const int villain[], int n,
+        unsigned int& count) {
+    for (int i = 0; i < n; i++) {
+        if (hero[i] > villain[i]) {
+            count += 2;
+        }
+        else if (hero[i] == villain[i]) {
+            count += 1;
+        }
+    }
+}
 
 float hand_vs_hand_monte_carlo(unsigned long long hand,
         unsigned long long villain_hand,
@@ -9,28 +24,29 @@ float hand_vs_hand_monte_carlo(unsigned long long hand,
         int num_board,
         int iterations) {
     unsigned int count = 0;
-    unsigned int option_index = 0;
-    unsigned long long option;
-    unsigned long long dealt;
-    unsigned int hero;
-    unsigned int villain;
     unsigned long long board;
 
-    dealt = hand | villain_hand;
-    for (int i = 0; i < iterations; i++) {
-        board = start_board;
+    unsigned long long hero_hands[EVAL_BATCH_SIZE], villain_hands[EVAL_BATCH_SIZE];
+    int hero[EVAL_BATCH_SIZE], villain[EVAL_BATCH_SIZE];
 
-        for (int j = 0; j < (5 - num_board); j++) {
-            board |= deal_card(board | dealt);
-        }
-        hero = evaluate(board | hand, 7);
-        villain = evaluate(board | villain_hand, 7);
-        if (hero > villain) {
-            count += 2;
-        }
-        else if (hero == villain) {
-            count += 1;
+    Deck deck(hand | villain_hand | start_board);
+    for (int i = 0; i < iterations; i += EVAL_BATCH_SIZE) {
+        int batch_size = min(EVAL_BATCH_SIZE, iterations - i);
+
+        for (int k = 0; k < batch_size; k++) {
+            board = start_board;
+
+            deck.reset();
+            for (int j = 0; j < (5 - num_board); j++) {
+                board |= deck.deal_mask();
+            }
+            hero_hands[k] = board | hand;
+            villain_hands[k] = board | villain_hand;
         }
+
+        evaluate_batch(hero_hands, batch_size, hero);
+        evaluate_batch(villain_hands, batch_size, villain);
+        tally_showdowns(hero, villain, batch_size, count);
     }
     return 0.5 * (double)count / (double)iterations;
 }
@@ -46,10 +62,6 @@ float hand_vs_range_monte_carlo(unsigned long long hand,
     // common_dead = cards that cannot appear on the board or in villain's range
     // villain_dead = cards that can appear on the board but not in villain's range
     unsigned int count = 0;
-    unsigned long long option;
-    unsigned long long dealt;
-    unsigned int hero;
-    unsigned int villain;
     unsigned long long villain_hand;
     unsigned long long board;
 
@@ -59,31 +71,26 @@ float hand_vs_range_monte_carlo(unsigned long long hand,
             full_villain_range, num_full_villain_range,
             villain_range, num_villain_range);
 
-    unsigned long long dead = hand | common_dead;
+    // villain's cards change every sample, so they are skipped while dealing
+    StratifiedDeck deck(hand | common_dead | start_board);
+    RangeWalk walk(num_villain_range); // spread samples evenly over the range
 
-    int option_index = 0; // iterate over villain range to evenly sample
-    for (int i = 0; i < iterations; i++) {
-        villain_hand = villain_range[option_index];
-        option_index += 1;
-        if (option_index >= num_villain_range) {
-            option_index = 0;
-        }
+    unsigned long long hero_hands[EVAL_BATCH_SIZE], villain_hands[EVAL_BATCH_SIZE];
+    int hero[EVAL_BATCH_SIZE], villain[EVAL_BATCH_SIZE];
 
-        dealt = dead | villain_hand;
-        
-        board = start_board;
-        for (int j = 0; j < (5 - num_board); j++) {
-            board |= deal_card(board | dealt);
-        }
-        hero = evaluate(board | hand, 7);
-        villain = evaluate(board | villain_hand, 7);
+    for (int i = 0; i < iterations; i += EVAL_BATCH_SIZE) {
+        int batch_size = min(EVAL_BATCH_SIZE, iterations - i);
 
-        if (hero > villain) {
-            count += 2;
-        }
-        else if (hero == villain) {
-            count += 1;
+        for (int k = 0; k < batch_size; k++) {
+            villain_hand = villain_range[walk.next()];
+            board = start_board | deck.deal_runout(5 - num_board, villain_hand);
+            hero_hands[k] = board | hand;
+            villain_hands[k] = board | villain_hand;
         }
+
+        evaluate_batch(hero_hands, batch_size, hero);
+        evaluate_batch(villain_hands, batch_size, villain);
+        tally_showdowns(hero, villain, batch_size, count);
     }
     return 0.5 * (double)count / (double)iterations;
 }
@@ -103,40 +110,41 @@ float hand_vs_random_monte_carlo(unsigned long long hand,
         int num_board,
         int iterations) {
     unsigned int count = 0;
-    unsigned long long dealt;
-    unsigned int hero;
-    unsigned int villain;
     unsigned long long villain_hand;
     unsigned long long board;
 
-    for (int i = 0; i < iterations; i++) {
-        villain_hand = 0;
-        for (int j = 0; j < 2; j++) {
-            villain_hand |= deal_card(hand | start_board);
-        }
+    Deck deck(hand | start_board);
 
-        dealt = hand | villain_hand;
-        
-        board = start_board;
-        for (int j = 0; j < (5 - num_board); j++) {
-            board |= deal_card(board | dealt);
-        }
-        hero = evaluate(board | hand, 7);
-        villain = evaluate(board | villain_hand, 7);
+    unsigned long long hero_hands[EVAL_BATCH_SIZE], villain_hands[EVAL_BATCH_SIZE];
+    int hero[EVAL_BATCH_SIZE], villain[EVAL_BATCH_SIZE];
 
-        if (hero > villain) {
-            count += 2;
-        }
-        else if (hero == villain) {
-            count += 1;
+    for (int i = 0; i < iterations; i += EVAL_BATCH_SIZE) {
+        int batch_size = min(EVAL_BATCH_SIZE, iterations - i);
+
+        for (int k = 0; k < batch_size; k++) {
+            deck.reset();
+            villain_hand = deck.deal_mask() | deck.deal_mask();
+
+            board = start_board;
+            for (int j = 0; j < (5 - num_board); j++) {
+                board |= deck.deal_mask();
+            }
+            hero_hands[k] = board | hand;
+            villain_hands[k] = board | villain_hand;
         }
+
+        evaluate_batch(hero_hands, batch_size, hero);
+        evaluate_batch(villain_hands, batch_size, villain);
+        tally_showdowns(hero, villain, batch_size, count);
     }
     return 0.5 * (double)count / (double)iterations;
 }
 
-void hand_vs_hand_exact_iterate(unsigned long long hand,
+// exact enumeration recurses over runout cards, adding each dealt card to the
+// board state so the leaves only add hole-card rank keys (see EvalBoard)
+static void hand_vs_hand_exact_incremental(unsigned long long hand,
         unsigned long long villain_hand,
-        unsigned long long board,
+        const EvalBoard& board,
         int num_board,
         int num_card,
         unsigned long long dead,
@@ -145,8 +153,8 @@ void hand_vs_hand_exact_iterate(unsigned long long hand,
 
     if (num_board == 0) {
 
-        unsigned int hero = evaluate(board | hand, 7);
-        unsigned int villain = evaluate(board | villain_hand, 7);
+        int hero = evaluate_with_board(board, hand);
+        int villain = evaluate_with_board(board, villain_hand);
 
         if (hero > villain) {
             count += 2;
@@ -160,18 +168,33 @@ void hand_vs_hand_exact_iterate(unsigned long long hand,
     else {
         for (int i = num_board-1; i < num_card; i++) {
             if ((CARD_MASKS_TABLE[i] & dead) == 0) {
-                hand_vs_hand_exact_iterate(hand, villain_hand, board | CARD_MASKS_TABLE[i],
-                    num_board-1, i, dead | CARD_MASKS_TABLE[i], count, total);
+                EvalBoard next = board;
+                add_board_cards(next, CARD_MASKS_TABLE[i]);
+                hand_vs_hand_exact_incremental(hand, villain_hand,
+                    next, num_board-1, i, dead | CARD_MASKS_TABLE[i], count, total);
             }
         }
     }
 
 }
 
-void hand_vs_range_exact_iterate(unsigned long long hand,
+void hand_vs_hand_exact_iterate(unsigned long long hand,
+        unsigned long long villain_hand,
+        unsigned long long board,
+        int num_board,
+        int num_card,
+        unsigned long long dead,
+        unsigned int& count,
+        unsigned int& total) {
+
+    hand_vs_hand_exact_incremental(hand, villain_hand, make_eval_board(board), num_board, num_card, dead, count, total);
+
+}
+
+static void hand_vs_range_exact_incremental(unsigned long long hand,
         unsigned long long villain_range[],
         int num_villain_range,
-        unsigned long long board,
+        const EvalBoard& board,
         int num_board,
         int num_card,
         unsigned long long dead,
@@ -180,33 +203,25 @@ void hand_vs_range_exact_iterate(unsigned long long hand,
 
     if (num_board == 0) {
 
-        unsigned int hero = evaluate(board | hand, 7);
-        unsigned int villain;
+        int hero = evaluate_with_board(board, hand);
 
         for (int i = 0; i < num_villain_range; i++) {
-
             if ((dead & villain_range[i]) == 0) {
+                int villain = evaluate_with_board(board, villain_range[i]);
 
-                villain = evaluate(board | villain_range[i], 7);
-
-                if (hero > villain) {
-                    count += 2;
-                }
-                else if (hero == villain) {
-                    count += 1;
-                }
-
+                // 2 for a win, 1 for a chop (branch-free, outcomes are unpredictable)
+                count += (hero > villain) + (hero >= villain);
                 total++;
-
             }
-
         }
     }
     else {
         for (int i = num_board-1; i < num_card; i++) {
             if ((CARD_MASKS_TABLE[i] & dead) == 0) {
-                hand_vs_range_exact_iterate(hand, villain_range, num_villain_range, 
-                    board | CARD_MASKS_TABLE[i], num_board-1, i, dead | CARD_MASKS_TABLE[i],
+                EvalBoard next = board;
+                add_board_cards(next, CARD_MASKS_TABLE[i]);
+                hand_vs_range_exact_incremental(hand, villain_range,
+                    num_villain_range, next, num_board-1, i, dead | CARD_MASKS_TABLE[i],
                     count, total);
             }
         }
@@ -214,6 +229,20 @@ void hand_vs_range_exact_iterate(unsigned long long hand,
 
 }
 
+void hand_vs_range_exact_iterate(unsigned long long hand,
+        unsigned long long villain_range[],
+        int num_villain_range,
+        unsigned long long board,
+        int num_board,
+        int num_card,
+        unsigned long long dead,
+        unsigned int& count,
+        unsigned int& total) {
+
+    hand_vs_range_exact_incremental(hand, villain_range, num_villain_range, make_eval_board(board), num_board, num_card, dead, count, total);
+
+}
+
 float hand_vs_range_exact(unsigned long long hand,
         unsigned long long full_villain_range[],
         int num_full_villain_range,
@@ -224,13 +253,24 @@ float hand_vs_range_exact(unsigned long long hand,
     // common_dead = cards that cannot appear on the board or in villain's range
     // villain_dead = cards that can appear on the board but not in villain's range
 
+    unsigned int count = 0, total = 0;
+
+    if (num_board == 5) {
+        // a single runout reads the range once, so skip the filtered copy and
+        // let the leaf drop dead combos
+        hand_vs_range_exact_incremental(hand, full_villain_range, num_full_villain_range,
+                                        make_eval_board(start_board), 0, 52,
+                                        hand | start_board | common_dead | villain_dead,
+                                        count, total);
+        return 0.5 * (double)count / (double)total;
+    }
+
     unsigned long long villain_range[num_full_villain_range];
     int num_villain_range;
     filter_range(hand | start_board | common_dead | villain_dead,
             full_villain_range, num_full_villain_range,
             villain_range, num_villain_range);
     
-    unsigned int count = 0, total = 0;
     hand_vs_range_exact_iterate(hand, villain_range,
                                 num_villain_range, start_board,
                                 5-num_board, 52,
@@ -239,3 +279,330 @@ float hand_vs_range_exact(unsigned long long hand,
 
     return 0.5 * (double)count / (double)total;
 }
+
+MultiRange make_multi_range(const unsigned long long* const ranges[],
+        const int num_range[],
+        int num_ranges) {
+    assert(num_ranges <= MAX_MULTI_RANGES);
+
+    vector<unsigned long long> combos;
+    vector<vector<int>> weights; // weights[entry][r] = times range r lists the combo
+    vector<vector<int>> range_entries(num_ranges);
+
+    // union entries by (lowest card, highest card)
+    vector<int> slots(52*52, -1);
+    for (int r = 0; r < num_ranges; r++) {
+        for (int i = 0; i < num_range[r]; i++) {
+            unsigned long long combo = ranges[r][i];
+            int& slot = slots[52*__builtin_ctzll(combo) + (63 - __builtin_clzll(combo))];
+            if (slot == -1) {
+                slot = combos.size();
+                combos.push_back(combo);
+                weights.push_back(vector<int>(num_ranges, 0));
+            }
+
+            weights[slot][r]++;
+            range_entries[r].push_back(slot);
+        }
+    }
+
+    // order entries by weights so each group shares one set of range weights
+    vector<int> order(combos.size());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&weights](int i, int j) {
+        return weights[i] < weights[j];
+    });
+
+    MultiRange multi;
+    multi.num_ranges = num_ranges;
+    vector<int> new_index(combos.size());
+    for (int i = 0; i < order.size(); i++) {
+        new_index[order[i]] = i;
+        multi.combos.push_back(combos[order[i]]);
+        if (i == 0 || weights[order[i]] != weights[order[i-1]]) {
+            multi.group_starts.push_back(i);
+            multi.group_weights.insert(multi.group_weights.end(),
+                                       weights[order[i]].begin(), weights[order[i]].end());
+        }
+    }
+    multi.group_starts.push_back(order.size());
+
+    multi.range_combos.resize(num_ranges);
+    for (int r = 0; r < num_ranges; r++) {
+        for (int entry : range_entries[r]) {
+            multi.range_combos[r].push_back(new_index[entry]);
+        }
+    }
+
+    return multi;
+}
+
+static void hand_vs_ranges_exact_incremental(unsigned long long hand,
+        const MultiRange& multi,
+        const EvalBoard& board,
+        int num_board,
+        int num_card,
+        unsigned long long dead,
+        unsigned long long villain_dead,
+        unsigned int count[],
+        unsigned int total[]) {
+
+    if (num_board == 0) {
+
+        int hero = evaluate_with_board(board, hand);
+        unsigned long long combo_dead = dead | villain_dead;
+
+        for (int g = 0; g + 1 < multi.group_starts.size(); g++) {
+            unsigned int group_count = 0, group_total = 0;
+
+            for (int i = multi.group_starts[g]; i < multi.group_starts[g+1]; i++) {
+                unsigned long long combo = multi.combos[i];
+                if ((combo_dead & combo) == 0) {
+                    int villain = evaluate_with_board(board, combo);
+                    group_count += (hero > villain) + (hero >= villain);
+                    group_total++;
+                }
+            }
+
+            // every combo in the group has the same weight in each range
+            const int* weights = &multi.group_weights[g*multi.num_ranges];
+            for (int r = 0; r < multi.num_ranges; r++) {
+                count[r] += weights[r]*group_count;
+                total[r] += weights[r]*group_total;
+            }
+        }
+    }
+    else {
+        for (int i = num_board-1; i < num_card; i++) {
+            if ((CARD_MASKS_TABLE[i] & dead) == 0) {
+                EvalBoard next = board;
+                add_board_cards(next, CARD_MASKS_TABLE[i]);
+                hand_vs_ranges_exact_incremental(hand, multi, next, num_board-1, i,
+                    dead | CARD_MASKS_TABLE[i], villain_dead, count, total);
+            }
+        }
+    }
+
+}
+
+void hand_vs_ranges_exact(unsigned long long hand,
+        const MultiRange& multi,
+        unsigned long long start_board,
+        int num_board,
+        float equities[],
+        unsigned long long common_dead,
+        unsigned long long villain_dead) {
+
+    unsigned int count[MAX_MULTI_RANGES] = {0}, total[MAX_MULTI_RANGES] = {0};
+
+    hand_vs_ranges_exact_incremental(hand, multi, make_eval_board(start_board),
+                                     5-num_board, 52, hand | start_board | common_dead,
+                                     villain_dead, count, total);
+
+    for (int r = 0; r < multi.num_ranges; r++) {
+        equities[r] = 0.5 * (double)count[r] / (double)total[r];
+    }
+}
+
+RangesMonteCarlo::RangesMonteCarlo(unsigned long long hand,
+        const MultiRange& multi,
+        unsigned long long start_board,
+        int num_board,
+        unsigned long long common_dead,
+        unsigned long long villain_dead) :
+        multi(multi), hand(hand), start_board(start_board), num_board(num_board),
+        static_dead(hand | common_dead | start_board | villain_dead),
+        deck(hand | common_dead | start_board), iterations(0), evaluations(0) {
+
+    for (int r = 0; r < multi.num_ranges; r++) {
+        walks.push_back(RangeWalk(multi.range_combos[r].size()));
+        active[r] = true;
+        count[r] = 0;
+        square[r] = 0;
+        total[r] = 0;
+    }
+}
+
+void RangesMonteCarlo::sample(int num_samples) {
+    for (int i = 0; i < num_samples; i++) {
+        unsigned long long runout = deck.deal_runout(5 - num_board);
+        unsigned long long board = start_board | runout;
+
+        EvalBoard state = make_eval_board(board);
+        int hero = evaluate_with_board(state, hand);
+        evaluations++;
+
+        for (int r = 0; r < multi.num_ranges; r++) {
+            if (!active[r]) continue;
+
+            const vector<int>& range = multi.range_combos[r];
+            int num_range = range.size();
+
+            // next combo in the range that can ever be live
+            unsigned long long villain_hand = 0;
+            for (int k = 0; k < num_range; k++) {
+                unsigned long long combo = multi.combos[range[walks[r].next()]];
+                if ((combo & static_dead) == 0) {
+                    villain_hand = combo;
+                    break;
+                }
+            }
+
+            // drop the sample if the runout collides with it, rather than moving
+            // on to the next combo, so every (combo, runout) pair is equally likely
+            if (villain_hand == 0 || (villain_hand & runout) != 0) continue;
+
+            int villain = evaluate_with_board(state, villain_hand);
+            evaluations++;
+            unsigned int score = (hero > villain) + (hero >= villain);
+            count[r] += score;
+            square[r] += score*score;
+            total[r]++;
+        }
+    }
+    iterations += num_samples;
+}
+
+void RangesMonteCarlo::equities(float equities[]) const {
+    for (int r = 0; r < multi.num_ranges; r++) {
+        if (total[r] == 0) { // nothing sampled yet: an even split
+            equities[r] = 0.5;
+            continue;
+        }
+        equities[r] = 0.5 * (double)count[r] / (double)total[r];
+    }
+}
+
+void RangesMonteCarlo::variances(float variances[]) const {
+    for (int r = 0; r < multi.num_ranges; r++) {
+        if (total[r] < 2) {
+            variances[r] = 1.0;
+            continue;
+        }
+        // scores are 0/1/2, so equity = score/2 and var(equity) = var(score)/4
+        double mean = (double)count[r] / (double)total[r];
+        double var = (double)square[r] / (double)total[r] - mean*mean;
+
+        // a near lock often wins (or loses) every early sample, for a sample
+        // variance of 0. Floor it with the Agresti-Coull binomial variance
+        // (z = 2: two wins and two losses added), which stays positive at 0 and 1
+        double n = (double)total[r] + 4;
+        double p = (0.5 * (double)count[r] + 2) / n;
+        variances[r] = max(0.25 * max(var, 0.0) / (double)(total[r] - 1), p*(1 - p) / n);
+    }
+}
+
+void hand_vs_ranges_monte_carlo(unsigned long long hand,
+        const MultiRange& multi,
+        unsigned long long start_board,
+        int num_board,
+        int iterations,
+        float equities[],
+        unsigned long long common_dead,
+        unsigned long long villain_dead) {
+
+    RangesMonteCarlo sampler(hand, multi, start_board, num_board,
+                             common_dead, villain_dead);
+    sampler.sample(iterations);
+    sampler.equities(equities);
+}
+
+RiverBoardCache::RiverBoardCache(unsigned long long board, const MultiRange& multi) :
+        board(board), num_ranges(multi.num_ranges),
+        values(52*52, -1), strengths(52*52, -1),
+        weights(52*52*multi.num_ranges, 0) {
+
+    EvalBoard state = make_eval_board(board);
+
+    // evaluate every live combo once
+    vector<int> live_values;
+    for (int i = 0; i < 52; i++) {
+        for (int j = i+1; j < 52; j++) {
+            unsigned long long hole = CARD_MASKS_TABLE[i] | CARD_MASKS_TABLE[j];
+            if ((hole & board) == 0) {
+                values[combo_index(hole)] = evaluate_with_board(state, hole);
+                live_values.push_back(values[combo_index(hole)]);
+            }
+        }
+    }
+
+    // rank the distinct values
+    sort(live_values.begin(), live_values.end());
+    live_values.erase(unique(live_values.begin(), live_values.end()), live_values.end());
+    num_strengths = live_values.size();
+
+    for (int c = 0; c < 52*52; c++) {
+        if (values[c] != -1) {
+            strengths[c] = lower_bound(live_values.begin(), live_values.end(), values[c])
+                            - live_values.begin();
+        }
+    }
+
+    // per-combo range weights from the union groups
+    for (int g = 0; g + 1 < multi.group_starts.size(); g++) {
+        for (int i = multi.group_starts[g]; i < multi.group_starts[g+1]; i++) {
+            int c = combo_index(multi.combos[i]);
+            for (int r = 0; r < num_ranges; r++) {
+                weights[c*num_ranges + r] = multi.group_weights[g*num_ranges + r];
+            }
+        }
+    }
+
+    // weight of live combos at each strength, then prefix summed
+    below.assign(num_ranges*(num_strengths+1), 0);
+    for (int c = 0; c < 52*52; c++) {
+        if (strengths[c] != -1) {
+            for (int r = 0; r < num_ranges; r++) {
+                below[r*(num_strengths+1) + strengths[c]+1] += weights[c*num_ranges + r];
+            }
+        }
+    }
+    for (int r = 0; r < num_ranges; r++) {
+        for (int k = 0; k < num_strengths; k++) {
+            below[r*(num_strengths+1) + k+1] += below[r*(num_strengths+1) + k];
+        }
+    }
+}
+
+void RiverBoardCache::equities(unsigned long long hand, float equities[],
+        unsigned long long dead) const {
+
+    int strength = strengths[combo_index(hand)];
+    assert(strength != -1);
+
+    int wins[MAX_MULTI_RANGES], ties[MAX_MULTI_RANGES], total[MAX_MULTI_RANGES];
+    for (int r = 0; r < num_ranges; r++) {
+        const int* range_below = &below[r*(num_strengths+1)];
+        wins[r] = range_below[strength];
+        ties[r] = range_below[strength+1] - range_below[strength];
+        total[r] = range_below[num_strengths];
+    }
+
+    // remove every live combo holding a blocked card (once per combo)
+    unsigned long long blocked = (hand | dead) & ~board;
+    for (unsigned long long a_mask = blocked; a_mask != 0; a_mask &= a_mask-1) {
+        int a = __builtin_ctzll(a_mask);
+        for (int b = 0; b < 52; b++) {
+            unsigned long long b_card = CARD_MASKS_TABLE[b];
+            if (b == a || (b_card & board) != 0 || ((b_card & blocked) != 0 && b < a)) {
+                continue;
+            }
+
+            int c = combo_index(CARD_MASKS_TABLE[a] | b_card);
+            const int* combo_weights = &weights[c*num_ranges];
+            for (int r = 0; r < num_ranges; r++) {
+                total[r] -= combo_weights[r];
+                if (strengths[c] < strength) {
+                    wins[r] -= combo_weights[r];
+                }
+                else if (strengths[c] == strength) {
+                    ties[r] -= combo_weights[r];
+                }
+            }
+        }
+    }
+
+    for (int r = 0; r < num_ranges; r++) {
+        equities[r] = 0.5 * (double)(2*wins[r] + ties[r]) / (double)total[r];
+    }
+}
@@ -1,5 +1,12 @@
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <immintrin.h>
+
 #include "evaluate.h"
 
+using namespace std;
+
 int CLUB_OFFSET = 0;
 int DIAMOND_OFFSET = 13;
 int HEART_OFFSET = 26;
@@ -24,7 +31,7 @@ unsigned int HANDTYPE_VALUE_TWOPAIR = (( (unsigned int)2) << HANDTYPE_SHIFT);
 unsigned int HANDTYPE_VALUE_PAIR = (( (unsigned int)1) << HANDTYPE_SHIFT);
 unsigned int HANDTYPE_VALUE_HIGHCARD = (( (unsigned int)0) << HANDTYPE_SHIFT);
 
-int evaluate(unsigned long long cards, unsigned int num_cards) {
+int evaluate_branching(unsigned long long cards, unsigned int num_cards) {
     unsigned int retval = 0, four_mask, three_mask, two_mask;
     
     unsigned int sc = (unsigned int)((cards >> (CLUB_OFFSET)) & 0x1fffUL);
@@ -76,10 +83,12 @@ int evaluate(unsigned long long cards, unsigned int num_cards) {
             if (st != 0) {
                 retval = HANDTYPE_VALUE_STRAIGHT + (st << TOP_CARD_SHIFT);
             }
+        }
 
+        // a flush or straight can only be beaten by quads or a full house,
+        // which need at least 3 duplicate ranks
         if (retval != 0 && n_dups < 3) {
             return retval;
-            }
         }
     }
 
@@ -149,3 +158,297 @@ int evaluate(unsigned long long cards, unsigned int num_cards) {
     }
 
 }
+
+//////////////////////////////////////////
+////// perfect-hash 7-card evaluator /////
+//////////////////////////////////////////
+
+const unsigned int SUIT_FLUSH_FLAG = 1U << 31;
+
+unsigned int SUIT_RANK_KEY_TABLE[8192];
+unsigned int FLUSH_TABLE[8192];
+vector<unsigned int> RANK_HASH_TABLE;
+
+// recurse over ranks, distributing the remaining cards among ranks [rank, 13)
+// and appending (key, value) for each complete 7-card rank multiset
+static void enumerate_rank_multisets(
+        int rank, int remaining, unsigned int key,
+        unsigned long long cards, int suit,
+        vector<pair<unsigned int, unsigned int>> &entries) {
+
+    if (remaining == 0) {
+        entries.push_back(make_pair(key, (unsigned int) evaluate_branching(cards, 7)));
+        return;
+    }
+    if (rank == 13) {
+        return;
+    }
+
+    for (int count = 0; count <= 4 && count <= remaining; count++) {
+        // deal copies of this rank round-robin over suits so that no suit
+        // ever holds more than two cards (i.e. the hand is never a flush)
+        unsigned long long new_cards = cards;
+        for (int i = 0; i < count; i++) {
+            new_cards |= CARD_MASKS_TABLE[13*((suit + i) % 4) + rank];
+        }
+        enumerate_rank_multisets(rank + 1, remaining - count,
+                                 key + count*RANK_KEYS[rank],
+                                 new_cards, (suit + count) % 4, entries);
+    }
+}
+
+static void bucket_rank_multisets(
+        vector<vector<pair<unsigned int, unsigned int>>> &rows) {
+    vector<pair<unsigned int, unsigned int>> entries;
+    enumerate_rank_multisets(0, 7, 0, 0, 0, entries);
+
+    rows.assign(RANK_HASH_NUM_ROWS, vector<pair<unsigned int, unsigned int>>());
+    for (int i = 0; i < entries.size(); i++) {
+        assert((entries[i].first >> RANK_HASH_ROW_SHIFT) < RANK_HASH_NUM_ROWS);
+        rows[entries[i].first >> RANK_HASH_ROW_SHIFT].push_back(entries[i]);
+    }
+}
+
+void compute_rank_hash_offsets(unsigned int offsets[]) {
+    vector<vector<pair<unsigned int, unsigned int>>> rows;
+    bucket_rank_multisets(rows);
+
+    // place densest rows first, each at the first offset where none of its
+    // columns collide with previously placed rows
+    vector<int> order(RANK_HASH_NUM_ROWS);
+    for (int i = 0; i < RANK_HASH_NUM_ROWS; i++) order[i] = i;
+    stable_sort(order.begin(), order.end(), [&rows](int a, int b) {
+        return rows[a].size() > rows[b].size();
+    });
+
+    vector<char> used;
+    int first_free = 0;
+    for (int i = 0; i < RANK_HASH_NUM_ROWS; i++) {
+        auto &row = rows[order[i]];
+        if (row.size() == 0) {
+            offsets[order[i]] = 0;
+            continue;
+        }
+
+        // no slot below the first free one can take this row's first column
+        while (first_free < used.size() && used[first_free]) first_free++;
+        unsigned int min_col = RANK_HASH_ROW_MASK;
+        for (auto &entry : row) {
+            min_col = min(min_col, entry.first & RANK_HASH_ROW_MASK);
+        }
+
+        unsigned int offset = (first_free > min_col) ? first_free - min_col : 0;
+        while (true) {
+            bool fits = true;
+            for (auto &entry : row) {
+                unsigned int index = offset + (entry.first & RANK_HASH_ROW_MASK);
+                if (index < used.size() && used[index]) {
+                    fits = false;
+                    break;
+                }
+            }
+            if (fits) break;
+            offset++;
+        }
+
+        offsets[order[i]] = offset;
+        for (auto &entry : row) {
+            unsigned int index = offset + (entry.first & RANK_HASH_ROW_MASK);
+            if (index >= used.size()) used.resize(index + 1, 0);
+            used[index] = 1;
+        }
+    }
+}
+
+#ifdef EVAL7PP_PERFECT_HASH
+static bool build_perfect_hash_tables() {
+    // per-suit partial rank keys and flush values
+    for (unsigned int mask = 0; mask < 8192; mask++) {
+        unsigned int key = 0;
+        for (int rank = 0; rank < 13; rank++) {
+            if (mask & (1U << rank)) {
+                key += RANK_KEYS[rank];
+            }
+        }
+        // flag flush suits in the top bit; the scalar evaluator returns early
+        // on flushes so never sees it, the batch kernel uses it to pick lanes
+        SUIT_RANK_KEY_TABLE[mask] = key | ((N_BITS_TABLE[mask] >= 5) ? SUIT_FLUSH_FLAG : 0);
+
+        // with 7 cards a flush can't coexist with quads or a full house,
+        // so the flush suit alone decides the hand value
+        FLUSH_TABLE[mask] = (N_BITS_TABLE[mask] >= 5)
+            ? evaluate_branching(((unsigned long long) mask) << SPADE_OFFSET, N_BITS_TABLE[mask])
+            : 0;
+    }
+
+    // values of all non-flush rank multisets, placed using the precomputed
+    // row offsets (slow to search for, so they are stored in arrays.cpp)
+    vector<vector<pair<unsigned int, unsigned int>>> rows;
+    bucket_rank_multisets(rows);
+
+    vector<char> used;
+    for (int i = 0; i < RANK_HASH_NUM_ROWS; i++) {
+        for (auto &entry : rows[i]) {
+            unsigned int index = RANK_HASH_OFFSETS[i] + (entry.first & RANK_HASH_ROW_MASK);
+            if (index >= used.size()) {
+                used.resize(index + 1, 0);
+                RANK_HASH_TABLE.resize(index + 1, 0);
+            }
+            assert(!used[index]); // offsets must be regenerated if keys change
+            used[index] = 1;
+            RANK_HASH_TABLE[index] = entry.second;
+        }
+    }
+
+    return true;
+}
+
+// tables are built during static initialization of this translation unit,
+// after the hand type constants above (and not at all without
+// EVAL7PP_PERFECT_HASH, which never reads them)
+static const bool PERFECT_HASH_TABLES_BUILT = build_perfect_hash_tables();
+#endif
+
+int evaluate_perfect_hash(unsigned long long cards) {
+    unsigned int sc = (unsigned int)((cards >> (CLUB_OFFSET)) & 0x1fffUL);
+    unsigned int sd = (unsigned int)((cards >> (DIAMOND_OFFSET)) & 0x1fffUL);
+    unsigned int sh = (unsigned int)((cards >> (HEART_OFFSET)) & 0x1fffUL);
+    unsigned int ss = (unsigned int)((cards >> (SPADE_OFFSET)) & 0x1fffUL);
+
+    // at most one suit can hold 5+ of 7 cards
+    unsigned int flush_mask =
+        ((N_BITS_TABLE[sc] >= 5) ? sc : 0) | ((N_BITS_TABLE[sd] >= 5) ? sd : 0)
+        | ((N_BITS_TABLE[sh] >= 5) ? sh : 0) | ((N_BITS_TABLE[ss] >= 5) ? ss : 0);
+    if (flush_mask != 0) {
+        return FLUSH_TABLE[flush_mask];
+    }
+
+    unsigned int key = SUIT_RANK_KEY_TABLE[sc] + SUIT_RANK_KEY_TABLE[sd]
+                        + SUIT_RANK_KEY_TABLE[sh] + SUIT_RANK_KEY_TABLE[ss];
+    return RANK_HASH_TABLE[RANK_HASH_OFFSETS[key >> RANK_HASH_ROW_SHIFT]
+                            + (key & RANK_HASH_ROW_MASK)];
+}
+
+EvalBoard make_eval_board(unsigned long long board) {
+    EvalBoard state = {0, 0, {0, 0, 0, 0}, -1, 0};
+    add_board_cards(state, board);
+    return state;
+}
+
+void add_board_cards(EvalBoard& board, unsigned long long cards) {
+    board.cards |= cards;
+#ifdef EVAL7PP_PERFECT_HASH
+    const int offsets[4] = {CLUB_OFFSET, DIAMOND_OFFSET, HEART_OFFSET, SPADE_OFFSET};
+
+    board.flush_suit = -1;
+    board.flush_offset = 0;
+    for (int s = 0; s < 4; s++) {
+        unsigned int added = (unsigned int)((cards >> offsets[s]) & 0x1fffUL);
+        board.key += SUIT_RANK_KEY_TABLE[added] & ~SUIT_FLUSH_FLAG;
+        board.suit_masks[s] |= added;
+
+        if (N_BITS_TABLE[board.suit_masks[s]] >= 3) {
+            board.flush_suit = s;
+            board.flush_offset = offsets[s];
+        }
+    }
+#endif
+}
+
+int evaluate(unsigned long long cards, unsigned int num_cards) {
+#ifdef EVAL7PP_PERFECT_HASH
+    if (num_cards == 7) {
+        return evaluate_perfect_hash(cards);
+    }
+#endif
+    return evaluate_branching(cards, num_cards);
+}
+
+//////////////////////////////////////////
+/////////// batched evaluation ///////////
+//////////////////////////////////////////
+
+static void evaluate_batch_scalar(const unsigned long long* cards, int n, int* out) {
+    for (int i = 0; i < n; i++) {
+        out[i] = evaluate(cards[i], 7);
+    }
+}
+
+#ifdef EVAL7PP_PERFECT_HASH
+// 13-bit suit masks of 8 hands as 32-bit lanes (hands 0-3 in lo, 4-7 in hi)
+__attribute__((target("avx2")))
+static inline __m256i suit_masks_avx2(__m256i lo, __m256i hi, int offset) {
+    const __m256i suit_bits = _mm256_set1_epi64x(0x1fff);
+    const __m256i interleave = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+    __m256i a = _mm256_and_si256(_mm256_srli_epi64(lo, offset), suit_bits);
+    __m256i b = _mm256_and_si256(_mm256_srli_epi64(hi, offset), suit_bits);
+    // [a0 b0 a1 b1 a2 b2 a3 b3] -> [a0 a1 a2 a3 b0 b1 b2 b3]
+    return _mm256_permutevar8x32_epi32(
+        _mm256_or_si256(a, _mm256_slli_epi64(b, 32)), interleave);
+}
+
+// perfect-hash evaluator on 8 hands at once using gathers
+__attribute__((target("avx2")))
+static void evaluate_batch_avx2(const unsigned long long* cards, int n, int* out) {
+    const int* suit_key_table = (const int*) SUIT_RANK_KEY_TABLE;
+    const int* flush_table = (const int*) FLUSH_TABLE;
+    const int* offsets_table = (const int*) RANK_HASH_OFFSETS;
+    const int* rank_table = (const int*) RANK_HASH_TABLE.data();
+
+    const __m256i flush_flag = _mm256_set1_epi32(SUIT_FLUSH_FLAG);
+    const __m256i row_mask = _mm256_set1_epi32(RANK_HASH_ROW_MASK);
+
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i lo = _mm256_loadu_si256((const __m256i*) (cards + i));
+        __m256i hi = _mm256_loadu_si256((const __m256i*) (cards + i + 4));
+
+        __m256i sc = suit_masks_avx2(lo, hi, CLUB_OFFSET);
+        __m256i sd = suit_masks_avx2(lo, hi, DIAMOND_OFFSET);
+        __m256i sh = suit_masks_avx2(lo, hi, HEART_OFFSET);
+        __m256i ss = suit_masks_avx2(lo, hi, SPADE_OFFSET);
+
+        __m256i key = _mm256_add_epi32(
+            _mm256_add_epi32(_mm256_i32gather_epi32(suit_key_table, sc, 4),
+                             _mm256_i32gather_epi32(suit_key_table, sd, 4)),
+            _mm256_add_epi32(_mm256_i32gather_epi32(suit_key_table, sh, 4),
+                             _mm256_i32gather_epi32(suit_key_table, ss, 4)));
+
+        // zero the key of flush lanes so their (unused) row lookup stays in bounds
+        __m256i is_flush = _mm256_cmpeq_epi32(_mm256_and_si256(key, flush_flag), flush_flag);
+        key = _mm256_andnot_si256(is_flush, key);
+
+        __m256i row = _mm256_i32gather_epi32(offsets_table,
+            _mm256_srli_epi32(key, RANK_HASH_ROW_SHIFT), 4);
+        __m256i value = _mm256_i32gather_epi32(rank_table,
+            _mm256_add_epi32(row, _mm256_and_si256(key, row_mask)), 4);
+
+        if (!_mm256_testz_si256(is_flush, is_flush)) {
+            // only the flush suit has a nonzero FLUSH_TABLE entry
+            __m256i zero = _mm256_setzero_si256();
+            __m256i flush_value = _mm256_or_si256(
+                _mm256_or_si256(_mm256_mask_i32gather_epi32(zero, flush_table, sc, is_flush, 4),
+                                _mm256_mask_i32gather_epi32(zero, flush_table, sd, is_flush, 4)),
+                _mm256_or_si256(_mm256_mask_i32gather_epi32(zero, flush_table, sh, is_flush, 4),
+                                _mm256_mask_i32gather_epi32(zero, flush_table, ss, is_flush, 4)));
+            value = _mm256_blendv_epi8(value, flush_value, is_flush);
+        }
+
+        _mm256_storeu_si256((__m256i*) (out + i), value);
+    }
+
+    evaluate_batch_scalar(cards + i, n - i, out + i);
+}
+#endif
+
+void evaluate_batch(const unsigned long long* cards, int n, int* out) {
+#ifdef EVAL7PP_PERFECT_HASH
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        evaluate_batch_avx2(cards, n, out);
+        return;
+    }
+#endif
+    evaluate_batch_scalar(cards, n, out);
+}